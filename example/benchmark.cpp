@@ -0,0 +1,78 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+#include "ioh.hpp"
+
+/// Returns the mean time in nanoseconds of a call to f, which returns a double that is kept alive
+template <typename F>
+double nanoseconds_per_call(F &&f, const size_t repetitions)
+{
+    volatile double sink = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < repetitions; ++i)
+        sink = sink + f();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(repetitions);
+}
+
+/// The Katsuura function as it was evaluated before it was vectorized: a table of powers and a pow per variable
+double katsuura_reference(const std::vector<double> &x, const std::vector<double> &powers, const double exponent,
+                          const double factor)
+{
+    auto result = 1.0;
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        double z = 0;
+        for (size_t j = 1; j < 33; ++j)
+            z += fabs(powers.at(j) * x[i] - floor(powers.at(j) * x[i] + 0.5)) / powers.at(j);
+
+        result *= pow(1.0 + (static_cast<double>(i) + 1) * z, exponent);
+    }
+    return factor * (-1. + result);
+}
+
+/// Compares the Katsuura kernel on every instruction set to the reference implementation
+void katsuura_benchmark()
+{
+    using namespace ioh::common::simd;
+    const auto detected = detect_instruction_set();
+    const std::vector<std::pair<InstructionSet, std::string>> sets{
+        {InstructionSet::Scalar, "scalar"}, {InstructionSet::AVX2, "avx2"}, {InstructionSet::AVX512, "avx512"}};
+
+    std::vector<double> powers(33);
+    for (auto j = 1; j < 33; ++j)
+        powers[j] = pow(2., static_cast<double>(j));
+
+    std::cout << "==========\nKatsuura, ns per evaluation (speedup over the reference)\n==========" << std::endl;
+    for (const size_t n : {10, 40, 160, 1000})
+    {
+        const auto x = ioh::common::random::uniform(n, 42, -5, 5);
+        const auto exponent = 10. / pow(static_cast<double>(n), 1.2);
+        const auto factor = 10. / static_cast<double>(n * n);
+        const auto repetitions = 2000000 / n;
+
+        const auto reference = nanoseconds_per_call(
+            [&] { return katsuura_reference(x, powers, exponent, factor); }, repetitions);
+        std::cout << "n = " << std::setw(5) << n << "  reference " << std::fixed << std::setprecision(0)
+                  << reference;
+
+        for (const auto &[set, name] : sets)
+        {
+            if (static_cast<int>(set) > static_cast<int>(detected))
+                continue;
+            set_instruction_set(set);
+            const auto time = nanoseconds_per_call(
+                [&] { return ioh::problem::bbob::kernels::katsuura(x.data(), n, exponent, factor); }, repetitions);
+            std::cout << "  " << name << " " << time << " (" << std::setprecision(1) << reference / time << "x)"
+                      << std::setprecision(0);
+        }
+        std::cout << std::endl;
+    }
+    set_instruction_set(detected);
+}
+
+int main()
+{
+    katsuura_benchmark();
+}
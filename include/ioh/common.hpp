@@ -3,6 +3,10 @@
 #include "common/config.hpp"
 #include "common/file.hpp"
 #include "common/log.hpp"
+#include "common/matrix.hpp"
 #include "common/random.hpp"
+#include "common/simd.hpp"
+#include "common/bitstring.hpp"
 #include "common/utils.hpp"
+#include "common/fft.hpp"
 #include "common/registry.hpp"
\ No newline at end of file
@@ -0,0 +1,279 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ioh/common/simd.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace ioh::common
+{
+    namespace bits
+    {
+        //! The number of bits which are set in a word
+        inline int popcount(const std::uint64_t word)
+        {
+#if defined(__GNUC__)
+            return __builtin_popcountll(word);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            return static_cast<int>(__popcnt64(word));
+#else
+            auto w = word - ((word >> 1) & 0x5555555555555555ULL);
+            w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+            w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+            return static_cast<int>((w * 0x0101010101010101ULL) >> 56);
+#endif
+        }
+
+        //! The number of zeros below the lowest bit which is set, 64 for a zero word
+        inline int count_trailing_zeros(const std::uint64_t word)
+        {
+            if (word == 0)
+                return 64;
+#if defined(__GNUC__)
+            return __builtin_ctzll(word);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+            unsigned long index;
+            _BitScanForward64(&index, word);
+            return static_cast<int>(index);
+#else
+            auto n = 0;
+            for (auto w = word; (w & 1) == 0; w >>= 1)
+                ++n;
+            return n;
+#endif
+        }
+
+        namespace detail
+        {
+            inline std::size_t popcount_scalar(const std::uint64_t *words, const std::size_t n)
+            {
+                std::size_t result = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                    result += static_cast<std::size_t>(popcount(words[i]));
+                return result;
+            }
+
+#if defined(IOH_SIMD_X86)
+            //! The same loop, compiled for the popcnt instruction instead of the generic bit manipulation
+            IOH_SIMD_TARGET("popcnt")
+            inline std::size_t popcount_native(const std::uint64_t *words, const std::size_t n)
+            {
+                std::size_t r0 = 0, r1 = 0, r2 = 0, r3 = 0;
+                std::size_t i = 0;
+                for (; i + 4 <= n; i += 4)
+                {
+                    r0 += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+                    r1 += static_cast<std::size_t>(__builtin_popcountll(words[i + 1]));
+                    r2 += static_cast<std::size_t>(__builtin_popcountll(words[i + 2]));
+                    r3 += static_cast<std::size_t>(__builtin_popcountll(words[i + 3]));
+                }
+                for (; i < n; ++i)
+                    r0 += static_cast<std::size_t>(__builtin_popcountll(words[i]));
+                return r0 + r1 + r2 + r3;
+            }
+
+            inline bool has_popcnt()
+            {
+                static const auto supported = [] {
+                    __builtin_cpu_init();
+                    return __builtin_cpu_supports("popcnt") != 0;
+                }();
+                return supported;
+            }
+#endif
+        }
+
+        //! The number of bits which are set in an array of words
+        inline std::size_t popcount(const std::uint64_t *words, const std::size_t n)
+        {
+#if defined(IOH_SIMD_X86)
+            if (simd::instruction_set() != simd::InstructionSet::Scalar && detail::has_popcnt())
+                return detail::popcount_native(words, n);
+#endif
+            return detail::popcount_scalar(words, n);
+        }
+    }
+
+    /**
+     * \brief A packed solution of a pseudo-Boolean problem, which stores 64 variables per word. Variable i is bit
+     * i % 64 of word i / 64, and the unused bits of the last word are always zero. It takes 32 times less memory
+     * than a std::vector<int>, and the functions which only depend on the number or the position of the ones can
+     * be evaluated a word at a time.
+     */
+    class BitString
+    {
+    public:
+        using Word = std::uint64_t;
+
+        //! The number of variables in a word
+        static constexpr std::size_t word_size = 64;
+
+    private:
+        std::size_t size_ = 0;
+        std::vector<Word> words_;
+
+        static std::size_t words_for(const std::size_t n) { return (n + word_size - 1) / word_size; }
+
+    public:
+        BitString() = default;
+
+        //! Creates a bit string of n zeros
+        explicit BitString(const std::size_t n) : size_(n), words_(words_for(n), 0) {}
+
+        /**
+         * \brief Packs a solution, in which every nonzero value is a one
+         * \param x pointer to the first of n values
+         * \param n the number of values
+         */
+        template <typename T>
+        BitString(const T *x, const std::size_t n)
+        {
+            assign(x, n);
+        }
+
+        //! Packs a solution, in which every nonzero value is a one
+        template <typename T>
+        explicit BitString(const std::vector<T> &x) : BitString(x.data(), x.size())
+        {
+        }
+
+        [[nodiscard]] std::size_t size() const { return size_; }
+
+        [[nodiscard]] std::size_t n_words() const { return words_.size(); }
+
+        [[nodiscard]] const Word *words() const { return words_.data(); }
+
+        //! The words, of which the caller has to keep the unused bits of the last word zero
+        [[nodiscard]] Word *words() { return words_.data(); }
+
+        [[nodiscard]] bool operator[](const std::size_t i) const
+        {
+            return ((words_[i / word_size] >> (i % word_size)) & 1) != 0;
+        }
+
+        void set(const std::size_t i, const bool value)
+        {
+            const auto bit = Word{1} << (i % word_size);
+            if (value)
+                words_[i / word_size] |= bit;
+            else
+                words_[i / word_size] &= ~bit;
+        }
+
+        void flip(const std::size_t i) { words_[i / word_size] ^= Word{1} << (i % word_size); }
+
+        //! Resizes the bit string to n zeros, reusing its memory when possible
+        void assign(const std::size_t n)
+        {
+            size_ = n;
+            words_.assign(words_for(n), 0);
+        }
+
+        /**
+         * \brief Packs a solution, in which every nonzero value is a one, reusing the memory of the bit string when
+         * possible
+         * \param x pointer to the first of n values
+         * \param n the number of values
+         */
+        template <typename T>
+        void assign(const T *x, const std::size_t n)
+        {
+            size_ = n;
+            words_.resize(words_for(n));
+            for (std::size_t w = 0, i = 0; w < words_.size(); ++w)
+            {
+                Word word = 0;
+                const auto end = std::min(n, i + word_size);
+                for (std::size_t bit = 0; i < end; ++i, ++bit)
+                    word |= static_cast<Word>(x[i] != T{0}) << bit;
+                words_[w] = word;
+            }
+        }
+
+        /**
+         * \brief Unpacks the bit string into an array of zeros and ones
+         * \param x pointer to the first of size() values
+         */
+        template <typename T>
+        void unpack(T *x) const
+        {
+            for (std::size_t w = 0, i = 0; w < words_.size(); ++w)
+            {
+                auto word = words_[w];
+                const auto end = std::min(size_, i + word_size);
+                for (; i < end; ++i, word >>= 1)
+                    x[i] = static_cast<T>(word & 1);
+            }
+        }
+
+        //! Unpacks the bit string into a vector, reusing its memory when possible
+        template <typename T>
+        void unpack(std::vector<T> &x) const
+        {
+            x.resize(size_);
+            unpack(x.data());
+        }
+
+        //! The bit string as a vector of zeros and ones
+        [[nodiscard]] std::vector<int> to_vector() const
+        {
+            std::vector<int> x;
+            unpack(x);
+            return x;
+        }
+
+        //! The number of ones
+        [[nodiscard]] std::size_t count() const { return bits::popcount(words_.data(), words_.size()); }
+
+        //! The number of consecutive ones at the start of the bit string
+        [[nodiscard]] std::size_t leading_ones() const
+        {
+            for (std::size_t w = 0; w < words_.size(); ++w)
+                if (words_[w] != ~Word{0})
+                    return std::min(size_, w * word_size + static_cast<std::size_t>(
+                                                               bits::count_trailing_zeros(~words_[w])));
+            return size_;
+        }
+
+        //! Flips the bits which are set in a mask of the same size
+        BitString &operator^=(const BitString &mask)
+        {
+            for (std::size_t w = 0; w < words_.size(); ++w)
+                words_[w] ^= mask.words_[w];
+            return *this;
+        }
+
+        /**
+         * \brief Reorders the bits, such that bit i of out is bit index[i] of this bit string
+         * \param index a permutation of 0..size()-1
+         * \param out the reordered bits, which should not be this bit string
+         */
+        template <typename Index>
+        void permute(const std::vector<Index> &index, BitString &out) const
+        {
+            out.size_ = size_;
+            out.words_.resize(words_.size());
+            for (std::size_t w = 0, i = 0; w < words_.size(); ++w)
+            {
+                Word word = 0;
+                const auto end = std::min(size_, i + word_size);
+                for (std::size_t bit = 0; i < end; ++i, ++bit)
+                {
+                    const auto j = static_cast<std::size_t>(index[i]);
+                    word |= ((words_[j / word_size] >> (j % word_size)) & 1) << bit;
+                }
+                out.words_[w] = word;
+            }
+        }
+
+        bool operator==(const BitString &other) const { return size_ == other.size_ && words_ == other.words_; }
+
+        bool operator!=(const BitString &other) const { return !(*this == other); }
+    };
+}
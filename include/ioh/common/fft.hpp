@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#include "ioh/common/config.hpp"
+#include "ioh/common/utils.hpp"
+
+namespace ioh::common
+{
+    /**
+     * \brief Computes the aperiodic autocorrelations c_k = sum_i x_i * x_{i+k}, k = 0 ... n - 1, of a real sequence
+     * of length n in O(n log n) time. The sequence is zero-padded to a power of two m >= 2n, such that the circular
+     * autocorrelation of length m equals the aperiodic one, and c is the inverse FFT of the power spectrum |X|^2.
+     * Both real FFTs of length m are done by a complex FFT of length m / 2, on the even and odd elements packed
+     * into the real and imaginary parts.
+     */
+    class Autocorrelation
+    {
+        using Complex = std::complex<double>;
+
+        size_t n_ = 0;
+
+        //! Half the padded length, the length of the complex FFTs
+        size_t half_ = 0;
+
+        //! exp(-2 pi i j / m) for j < m / 2, computed directly instead of by a recurrence for accuracy
+        std::vector<Complex> twiddles_;
+
+        //! The bit reversal permutation of the complex FFTs
+        std::vector<size_t> bit_reverse_;
+
+        //! The product of two complex numbers, without the checks for infinities of std::complex's operator*
+        static Complex multiply(const Complex a, const Complex b)
+        {
+            return {a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real()};
+        }
+
+        /**
+         * \brief In-place iterative radix-2 FFT of length half_, without the scaling of the inverse
+         * \param z the data, in natural order
+         * \param inverse whether to transform with the conjugated twiddles
+         */
+        void transform(Complex *z, const bool inverse) const
+        {
+            for (size_t i = 0; i < half_; ++i)
+                if (i < bit_reverse_[i])
+                    std::swap(z[i], z[bit_reverse_[i]]);
+
+            for (size_t length = 2; length <= half_; length *= 2)
+            {
+                const auto step = 2 * half_ / length;
+                for (size_t start = 0; start < half_; start += length)
+                    for (size_t j = 0; j < length / 2; ++j)
+                    {
+                        const auto w = inverse ? std::conj(twiddles_[j * step]) : twiddles_[j * step];
+                        const auto u = z[start + j];
+                        const auto v = multiply(z[start + j + length / 2], w);
+                        z[start + j] = u + v;
+                        z[start + j + length / 2] = u - v;
+                    }
+            }
+        }
+
+    public:
+        Autocorrelation() = default;
+
+        //! Prepares the transforms of a sequence of length n
+        explicit Autocorrelation(const size_t n) : n_(n), half_(1)
+        {
+            while (half_ < n)
+                half_ *= 2;
+
+            const auto m = static_cast<double>(2 * half_);
+            twiddles_.resize(half_);
+            for (size_t j = 0; j < half_; ++j)
+                twiddles_[j] = std::polar(1.0, -2.0 * IOH_PI * static_cast<double>(j) / m);
+
+            bit_reverse_.resize(half_);
+            for (size_t i = 1, j = 0; i < half_; ++i)
+            {
+                auto bit = half_ >> 1;
+                for (; (j & bit) != 0; bit >>= 1)
+                    j ^= bit;
+                j ^= bit;
+                bit_reverse_[i] = j;
+            }
+        }
+
+        [[nodiscard]] size_t size() const { return n_; }
+
+        /**
+         * \brief Computes the autocorrelations. Their rounding error grows like n log n times the machine epsilon,
+         * so for integer sequences they can be rounded to the exact values.
+         * \param x pointer to the first of size() elements of the sequence
+         * \param c pointer to size() elements, element k receives c_k
+         */
+        void operator()(const double *x, double *c) const
+        {
+            auto &z = thread_local_buffer<Complex, Autocorrelation>(half_);
+            auto &power = thread_local_buffer<double, Autocorrelation>(half_ + 1);
+
+            for (size_t j = 0; j < half_; ++j)
+                z[j] = Complex(2 * j < n_ ? x[2 * j] : 0.0, 2 * j + 1 < n_ ? x[2 * j + 1] : 0.0);
+            transform(z.data(), false);
+
+            for (size_t k = 0; k < half_; ++k)
+            {
+                const auto mirrored = std::conj(z[(half_ - k) % half_]);
+                const auto even = 0.5 * (z[k] + mirrored);
+                const auto difference = z[k] - mirrored;
+                const auto odd = Complex(0.5 * difference.imag(), -0.5 * difference.real());
+                power[k] = std::norm(even + multiply(twiddles_[k], odd));
+                if (k == 0)
+                    power[half_] = std::norm(even - odd);
+            }
+
+            for (size_t k = 0; k < half_; ++k)
+            {
+                const auto even = 0.5 * (power[k] + power[half_ - k]);
+                const auto odd = 0.5 * (power[k] - power[half_ - k]) * std::conj(twiddles_[k]);
+                z[k] = Complex(even - odd.imag(), odd.real());
+            }
+            transform(z.data(), true);
+
+            const auto scale = 1.0 / static_cast<double>(half_);
+            for (size_t k = 0; k < n_; ++k)
+                c[k] = (k % 2 == 0 ? z[k / 2].real() : z[k / 2].imag()) * scale;
+        }
+    };
+}
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace ioh::common
+{
+    /**
+     * \brief Allocator which aligns its memory to a given boundary, e.g. a cache line
+     * \tparam T the type of the elements
+     * \tparam Alignment the alignment in bytes
+     */
+    template <typename T, std::size_t Alignment = 64>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+        [[nodiscard]]
+        T *allocate(const std::size_t n)
+        {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T *ptr, std::size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t{Alignment});
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+
+        template <typename U>
+        bool operator!=(const AlignedAllocator<U, Alignment> &) const noexcept { return false; }
+    };
+
+    /**
+     * \brief Dense row-major matrix, stored in a single allocation. Every row starts on a 64 byte boundary:
+     * the rows are padded with zeros up to a multiple of the cache line size. A matrix can also be a read-only view
+     * of memory with the same layout which it does not own, such as a mapped file, see view. Such a matrix is
+     * copied into its own storage the first time it is accessed for writing.
+     * \tparam T the type of the elements
+     */
+    template <typename T = double>
+    class Matrix
+    {
+    public:
+        //! The alignment of the rows in bytes
+        static constexpr std::size_t alignment = 64;
+
+    private:
+        std::size_t rows_ = 0;
+        std::size_t cols_ = 0;
+        std::size_t stride_ = 0;
+        std::vector<T, AlignedAllocator<T, alignment>> data_;
+
+        //! Keeps the memory which a view refers to alive, it is empty when the matrix owns its elements
+        std::shared_ptr<const void> owner_;
+
+        //! The first element, in data_ or in the memory of owner_
+        const T *elements_ = nullptr;
+
+        //! Copies the elements of a view into data_, so that they can be modified
+        void detach()
+        {
+            if (owner_ == nullptr)
+                return;
+            data_.assign(elements_, elements_ + rows_ * stride_);
+            owner_.reset();
+            elements_ = data_.data();
+        }
+
+    public:
+        /**
+         * \brief The number of elements between the starts of two consecutive rows of a matrix with a given
+         * number of columns
+         */
+        static std::size_t padded(const std::size_t cols)
+        {
+            constexpr auto per_line = alignment / sizeof(T);
+            return (cols + per_line - 1) / per_line * per_line;
+        }
+
+        Matrix() = default;
+
+        /**
+         * \brief Creates a matrix of a given shape
+         * \param rows the number of rows
+         * \param cols the number of columns
+         * \param value the initial value of the elements
+         */
+        Matrix(const std::size_t rows, const std::size_t cols, const T value = T{}) :
+            rows_(rows), cols_(cols), stride_(padded(cols)), data_(rows * stride_, T{}), elements_(data_.data())
+        {
+            for (std::size_t i = 0; i < rows_; ++i)
+                std::fill(row(i), row(i) + cols_, value);
+        }
+
+        Matrix(const Matrix &other) :
+            rows_(other.rows_), cols_(other.cols_), stride_(other.stride_), data_(other.data_),
+            owner_(other.owner_), elements_(owner_ == nullptr ? data_.data() : other.elements_)
+        {
+        }
+
+        Matrix(Matrix &&other) noexcept :
+            rows_(other.rows_), cols_(other.cols_), stride_(other.stride_), data_(std::move(other.data_)),
+            owner_(std::move(other.owner_)), elements_(owner_ == nullptr ? data_.data() : other.elements_)
+        {
+            other.elements_ = other.data_.data();
+        }
+
+        Matrix &operator=(Matrix other) noexcept
+        {
+            rows_ = other.rows_;
+            cols_ = other.cols_;
+            stride_ = other.stride_;
+            data_ = std::move(other.data_);
+            owner_ = std::move(other.owner_);
+            elements_ = owner_ == nullptr ? data_.data() : other.elements_;
+            return *this;
+        }
+
+        /**
+         * \brief Creates a matrix which views memory that it does not own, without copying it
+         * \param owner keeps the memory alive for as long as the matrix, or any of its copies, views it
+         * \param elements the first element, aligned to alignment, followed by rows rows of padded(cols) elements
+         * \param rows the number of rows
+         * \param cols the number of columns
+         */
+        static Matrix view(std::shared_ptr<const void> owner, const T *elements, const std::size_t rows,
+                           const std::size_t cols)
+        {
+            Matrix matrix;
+            matrix.rows_ = rows;
+            matrix.cols_ = cols;
+            matrix.stride_ = padded(cols);
+            matrix.owner_ = std::move(owner);
+            matrix.elements_ = elements;
+            return matrix;
+        }
+
+        //! Whether the matrix views memory which it does not own
+        [[nodiscard]] bool is_view() const { return owner_ != nullptr; }
+
+        [[nodiscard]] std::size_t rows() const { return rows_; }
+
+        [[nodiscard]] std::size_t cols() const { return cols_; }
+
+        //! The distance in elements between the starts of two consecutive rows
+        [[nodiscard]] std::size_t stride() const { return stride_; }
+
+        [[nodiscard]] T *data()
+        {
+            detach();
+            return data_.data();
+        }
+
+        [[nodiscard]] const T *data() const { return elements_; }
+
+        [[nodiscard]] T *row(const std::size_t i) { return data() + i * stride_; }
+
+        [[nodiscard]] const T *row(const std::size_t i) const { return elements_ + i * stride_; }
+
+        //! Row access, so that elements can be indexed as m[i][j]
+        T *operator[](const std::size_t i) { return row(i); }
+
+        const T *operator[](const std::size_t i) const { return row(i); }
+
+        T &operator()(const std::size_t i, const std::size_t j) { return data()[i * stride_ + j]; }
+
+        const T &operator()(const std::size_t i, const std::size_t j) const { return elements_[i * stride_ + j]; }
+    };
+}
@@ -152,5 +152,12 @@ namespace ioh::common
     {
         InvokeApplyOnConstruction<Type, Factory> &invoker =
             RegistrationInvoker<Type, Factory>::registration_invoker;
+
+        AutomaticTypeRegistration() = default;
+
+        AutomaticTypeRegistration(const AutomaticTypeRegistration &) = default;
+
+        //! Every instance refers to the same invoker, so the registered types stay copy assignable
+        AutomaticTypeRegistration &operator=(const AutomaticTypeRegistration &) { return *this; }
     };
 }
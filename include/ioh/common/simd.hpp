@@ -0,0 +1,418 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+
+#if !defined(IOH_NO_SIMD) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define IOH_SIMD_X86
+#include <immintrin.h>
+#define IOH_SIMD_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace ioh::common::simd
+{
+    /**
+     * \brief The instruction sets for which vectorized kernels are available, ordered by width
+     */
+    enum class InstructionSet
+    {
+        Scalar,
+        SSE2,
+        AVX2,
+        AVX512
+    };
+
+    /**
+     * \brief Queries the processor for the widest instruction set which has a kernel. Vectorized kernels are only
+     * compiled by GCC compatible compilers targeting x86, and can be disabled by defining IOH_NO_SIMD.
+     */
+    inline InstructionSet detect_instruction_set()
+    {
+#if defined(IOH_SIMD_X86)
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f"))
+            return InstructionSet::AVX512;
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+            return InstructionSet::AVX2;
+        if (__builtin_cpu_supports("sse2"))
+            return InstructionSet::SSE2;
+#endif
+        return InstructionSet::Scalar;
+    }
+
+    //! The instruction set used by the kernels, which is detected on first use
+    inline InstructionSet &instruction_set()
+    {
+        static auto set = detect_instruction_set();
+        return set;
+    }
+
+    /**
+     * \brief Selects the instruction set used by the kernels, e.g. to compare them. Sets which are not supported
+     * by the processor fall back to the widest one which is. This is not thread safe.
+     * \param set the requested instruction set
+     */
+    inline void set_instruction_set(const InstructionSet set)
+    {
+        const auto supported = detect_instruction_set();
+        instruction_set() = static_cast<int>(set) < static_cast<int>(supported) ? set : supported;
+    }
+
+    //! The element-wise operation which leaves the result of a kernel unchanged
+    struct Identity
+    {
+        double operator()(size_t, const double value) const { return value; }
+    };
+
+    namespace kernels
+    {
+        inline void affine_scalar(const double *m, const size_t stride, const double *b, const double *x,
+                                  double *out, const size_t rows, const size_t cols)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const auto *row = m + i * stride;
+                auto sum = b != nullptr ? b[i] : 0.0;
+                for (size_t j = 0; j < cols; ++j)
+                    sum += x[j] * row[j];
+                out[i] = sum;
+            }
+        }
+
+        inline void weighted_distances_scalar(const double *c, const double *w, const size_t stride, const double *x,
+                                              double *out, const size_t rows, const size_t cols)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const auto *center = c + i * stride;
+                const auto *weights = w + i * stride;
+                auto sum = 0.0;
+                for (size_t j = 0; j < cols; ++j)
+                {
+                    const auto d = x[j] - center[j];
+                    sum += weights[j] * d * d;
+                }
+                out[i] = sum;
+            }
+        }
+
+#if defined(IOH_SIMD_X86)
+        template <size_t R>
+        IOH_SIMD_TARGET("sse2")
+        inline void dot_rows_sse2(const double *m, const size_t stride, const double *x, const size_t cols,
+                                  double *sums)
+        {
+            __m128d acc[R];
+            for (size_t r = 0; r < R; ++r)
+                acc[r] = _mm_setzero_pd();
+
+            size_t j = 0;
+            for (; j + 2 <= cols; j += 2)
+            {
+                const auto xv = _mm_loadu_pd(x + j);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm_add_pd(acc[r], _mm_mul_pd(_mm_load_pd(m + r * stride + j), xv));
+            }
+            if (j < cols)
+            {
+                const auto xv = _mm_load_sd(x + j);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm_add_pd(acc[r], _mm_mul_pd(_mm_load_pd(m + r * stride + j), xv));
+            }
+            for (size_t r = 0; r < R; ++r)
+                sums[r] = _mm_cvtsd_f64(_mm_add_sd(acc[r], _mm_unpackhi_pd(acc[r], acc[r])));
+        }
+
+        IOH_SIMD_TARGET("sse2")
+        inline void affine_sse2(const double *m, const size_t stride, const double *b, const double *x,
+                                double *out, const size_t rows, const size_t cols)
+        {
+            double sums[4];
+            size_t i = 0;
+            for (; i + 4 <= rows; i += 4)
+            {
+                dot_rows_sse2<4>(m + i * stride, stride, x, cols, sums);
+                for (size_t r = 0; r < 4; ++r)
+                    out[i + r] = b != nullptr ? b[i + r] + sums[r] : sums[r];
+            }
+            for (; i < rows; ++i)
+            {
+                dot_rows_sse2<1>(m + i * stride, stride, x, cols, sums);
+                out[i] = b != nullptr ? b[i] + sums[0] : sums[0];
+            }
+        }
+
+        IOH_SIMD_TARGET("sse2")
+        inline void weighted_distances_sse2(const double *c, const double *w, const size_t stride, const double *x,
+                                            double *out, const size_t rows, const size_t cols)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const auto *center = c + i * stride;
+                const auto *weights = w + i * stride;
+                auto acc = _mm_setzero_pd();
+
+                size_t j = 0;
+                for (; j + 2 <= cols; j += 2)
+                {
+                    const auto d = _mm_sub_pd(_mm_loadu_pd(x + j), _mm_load_pd(center + j));
+                    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_load_pd(weights + j), _mm_mul_pd(d, d)));
+                }
+                if (j < cols)
+                {
+                    const auto d = _mm_sub_pd(_mm_load_sd(x + j), _mm_load_pd(center + j));
+                    acc = _mm_add_pd(acc, _mm_mul_pd(_mm_load_pd(weights + j), _mm_mul_pd(d, d)));
+                }
+                out[i] = _mm_cvtsd_f64(_mm_add_sd(acc, _mm_unpackhi_pd(acc, acc)));
+            }
+        }
+
+        template <size_t R>
+        IOH_SIMD_TARGET("avx2,fma")
+        inline void dot_rows_avx2(const double *m, const size_t stride, const double *x, const size_t cols,
+                                  double *sums)
+        {
+            __m256d acc[R];
+            for (size_t r = 0; r < R; ++r)
+                acc[r] = _mm256_setzero_pd();
+
+            size_t j = 0;
+            for (; j + 4 <= cols; j += 4)
+            {
+                const auto xv = _mm256_loadu_pd(x + j);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm256_fmadd_pd(_mm256_load_pd(m + r * stride + j), xv, acc[r]);
+            }
+            if (j < cols)
+            {
+                const auto tail = static_cast<long long>(cols - j);
+                const auto mask = _mm256_set_epi64x(-(tail > 3), -(tail > 2), -(tail > 1), -1);
+                const auto xv = _mm256_maskload_pd(x + j, mask);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm256_fmadd_pd(_mm256_load_pd(m + r * stride + j), xv, acc[r]);
+            }
+            for (size_t r = 0; r < R; ++r)
+            {
+                const auto pair = _mm_add_pd(_mm256_castpd256_pd128(acc[r]), _mm256_extractf128_pd(acc[r], 1));
+                sums[r] = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+            }
+        }
+
+        IOH_SIMD_TARGET("avx2,fma")
+        inline void affine_avx2(const double *m, const size_t stride, const double *b, const double *x,
+                                double *out, const size_t rows, const size_t cols)
+        {
+            double sums[4];
+            size_t i = 0;
+            for (; i + 4 <= rows; i += 4)
+            {
+                dot_rows_avx2<4>(m + i * stride, stride, x, cols, sums);
+                for (size_t r = 0; r < 4; ++r)
+                    out[i + r] = b != nullptr ? b[i + r] + sums[r] : sums[r];
+            }
+            for (; i < rows; ++i)
+            {
+                dot_rows_avx2<1>(m + i * stride, stride, x, cols, sums);
+                out[i] = b != nullptr ? b[i] + sums[0] : sums[0];
+            }
+        }
+
+        IOH_SIMD_TARGET("avx2,fma")
+        inline void weighted_distances_avx2(const double *c, const double *w, const size_t stride, const double *x,
+                                            double *out, const size_t rows, const size_t cols)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const auto *center = c + i * stride;
+                const auto *weights = w + i * stride;
+                auto acc = _mm256_setzero_pd();
+
+                size_t j = 0;
+                for (; j + 4 <= cols; j += 4)
+                {
+                    const auto d = _mm256_sub_pd(_mm256_loadu_pd(x + j), _mm256_load_pd(center + j));
+                    acc = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_load_pd(weights + j), d), d, acc);
+                }
+                if (j < cols)
+                {
+                    const auto tail = static_cast<long long>(cols - j);
+                    const auto mask = _mm256_set_epi64x(-(tail > 3), -(tail > 2), -(tail > 1), -1);
+                    const auto d = _mm256_sub_pd(_mm256_maskload_pd(x + j, mask), _mm256_load_pd(center + j));
+                    acc = _mm256_fmadd_pd(_mm256_mul_pd(_mm256_load_pd(weights + j), d), d, acc);
+                }
+                const auto pair = _mm_add_pd(_mm256_castpd256_pd128(acc), _mm256_extractf128_pd(acc, 1));
+                out[i] = _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+            }
+        }
+
+// The AVX-512 intrinsics of some versions of GCC start from deliberately undefined vectors
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#endif
+        /**
+         * \brief The sum of the elements of a vector, added in the same order as _mm512_reduce_add_pd. GCC's
+         * _mm512_reduce_add_pd extracts the upper half into an undefined vector, which is reported as
+         * uninitialized where it is inlined, so the halves are extracted with a zeroing mask instead.
+         */
+        IOH_SIMD_TARGET("avx512f")
+        inline double reduce_add_avx512(const __m512d v)
+        {
+            const auto quad = _mm256_add_pd(_mm512_maskz_extractf64x4_pd(0xff, v, 1), _mm512_castpd512_pd256(v));
+            const auto pair = _mm_add_pd(_mm256_extractf128_pd(quad, 1), _mm256_castpd256_pd128(quad));
+            return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+        }
+
+        template <size_t R>
+        IOH_SIMD_TARGET("avx512f")
+        inline void dot_rows_avx512(const double *m, const size_t stride, const double *x, const size_t cols,
+                                    double *sums)
+        {
+            __m512d acc[R];
+            for (size_t r = 0; r < R; ++r)
+                acc[r] = _mm512_setzero_pd();
+
+            size_t j = 0;
+            for (; j + 8 <= cols; j += 8)
+            {
+                const auto xv = _mm512_loadu_pd(x + j);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm512_fmadd_pd(_mm512_load_pd(m + r * stride + j), xv, acc[r]);
+            }
+            if (j < cols)
+            {
+                const auto mask = static_cast<__mmask8>((1u << (cols - j)) - 1u);
+                const auto xv = _mm512_maskz_loadu_pd(mask, x + j);
+                for (size_t r = 0; r < R; ++r)
+                    acc[r] = _mm512_fmadd_pd(_mm512_load_pd(m + r * stride + j), xv, acc[r]);
+            }
+            for (size_t r = 0; r < R; ++r)
+                sums[r] = reduce_add_avx512(acc[r]);
+        }
+
+        IOH_SIMD_TARGET("avx512f")
+        inline void affine_avx512(const double *m, const size_t stride, const double *b, const double *x,
+                                  double *out, const size_t rows, const size_t cols)
+        {
+            double sums[4];
+            size_t i = 0;
+            for (; i + 4 <= rows; i += 4)
+            {
+                dot_rows_avx512<4>(m + i * stride, stride, x, cols, sums);
+                for (size_t r = 0; r < 4; ++r)
+                    out[i + r] = b != nullptr ? b[i + r] + sums[r] : sums[r];
+            }
+            for (; i < rows; ++i)
+            {
+                dot_rows_avx512<1>(m + i * stride, stride, x, cols, sums);
+                out[i] = b != nullptr ? b[i] + sums[0] : sums[0];
+            }
+        }
+
+        IOH_SIMD_TARGET("avx512f")
+        inline void weighted_distances_avx512(const double *c, const double *w, const size_t stride,
+                                              const double *x, double *out, const size_t rows, const size_t cols)
+        {
+            for (size_t i = 0; i < rows; ++i)
+            {
+                const auto *center = c + i * stride;
+                const auto *weights = w + i * stride;
+                auto acc = _mm512_setzero_pd();
+
+                size_t j = 0;
+                for (; j + 8 <= cols; j += 8)
+                {
+                    const auto d = _mm512_sub_pd(_mm512_loadu_pd(x + j), _mm512_load_pd(center + j));
+                    acc = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_load_pd(weights + j), d), d, acc);
+                }
+                if (j < cols)
+                {
+                    const auto mask = static_cast<__mmask8>((1u << (cols - j)) - 1u);
+                    const auto d = _mm512_sub_pd(_mm512_maskz_loadu_pd(mask, x + j), _mm512_load_pd(center + j));
+                    acc = _mm512_fmadd_pd(_mm512_mul_pd(_mm512_load_pd(weights + j), d), d, acc);
+                }
+                out[i] = reduce_add_avx512(acc);
+            }
+        }
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+    }
+
+    /**
+     * \brief Computes out_i = op(i, (m * x + b)_i), using the widest available instruction set. The vectorized
+     * kernels sum the products in a different order, and use fused multiply-adds, so their results can differ from
+     * the scalar kernel by a few ULP of sum_j |m_ij * x_j| per row. The same instruction set always gives the same
+     * result, though, so m * xopt - m * xopt is exactly zero.
+     * \param m the matrix, of which every row starts on a 64 byte boundary and is padded with zeros up to a
+     * multiple of 8 elements, as in common::Matrix
+     * \param stride the distance in elements between the starts of two consecutive rows of m
+     * \param b the vector which is added, with rows elements, or nullptr to compute the linear transformation
+     * \param x the vector which is transformed, with cols elements
+     * \param out the result, with rows elements, which should not overlap with x
+     * \param rows the number of rows of m
+     * \param cols the number of columns of m
+     * \param op element-wise operation, which is applied to the result while it is still in the L1 cache. It is
+     * not applied inside the vectorized kernels, since calls into libm from vectorized code are much slower.
+     */
+    template <typename Op = Identity>
+    void affine(const double *m, const size_t stride, const double *b, const double *x, double *out,
+                const size_t rows, const size_t cols, const Op &op = {})
+    {
+        switch (instruction_set())
+        {
+#if defined(IOH_SIMD_X86)
+        case InstructionSet::AVX512:
+            kernels::affine_avx512(m, stride, b, x, out, rows, cols);
+            break;
+        case InstructionSet::AVX2:
+            kernels::affine_avx2(m, stride, b, x, out, rows, cols);
+            break;
+        case InstructionSet::SSE2:
+            kernels::affine_sse2(m, stride, b, x, out, rows, cols);
+            break;
+#endif
+        default:
+            kernels::affine_scalar(m, stride, b, x, out, rows, cols);
+        }
+
+        if constexpr (!std::is_same_v<Op, Identity>)
+            for (size_t i = 0; i < rows; ++i)
+                out[i] = op(i, out[i]);
+    }
+
+    /**
+     * \brief Computes out_i = sum_j w_ij * (x_j - c_ij)^2, the weighted squared distances of x to the rows of c,
+     * using the widest available instruction set. As for affine, the vectorized kernels can differ from the
+     * scalar kernel by a few ULP.
+     * \param c the centers, one per row, laid out as the matrix of affine
+     * \param w the weights, with the same shape and stride as c, and padded with zeros
+     * \param stride the distance in elements between the starts of two consecutive rows of c and w
+     * \param x the vector of which the distances are computed, with cols elements
+     * \param out the distances, with rows elements
+     * \param rows the number of rows of c and w
+     * \param cols the number of columns of c and w
+     */
+    inline void weighted_distances(const double *c, const double *w, const size_t stride, const double *x,
+                                   double *out, const size_t rows, const size_t cols)
+    {
+        switch (instruction_set())
+        {
+#if defined(IOH_SIMD_X86)
+        case InstructionSet::AVX512:
+            kernels::weighted_distances_avx512(c, w, stride, x, out, rows, cols);
+            break;
+        case InstructionSet::AVX2:
+            kernels::weighted_distances_avx2(c, w, stride, x, out, rows, cols);
+            break;
+        case InstructionSet::SSE2:
+            kernels::weighted_distances_sse2(c, w, stride, x, out, rows, cols);
+            break;
+#endif
+        default:
+            kernels::weighted_distances_scalar(c, w, stride, x, out, rows, cols);
+        }
+    }
+}
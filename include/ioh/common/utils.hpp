@@ -2,6 +2,7 @@
 
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
 #include <iostream>
@@ -23,6 +24,9 @@
 #include <cstdlib>
 #include <utility>
 #include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <thread>
 
 #include "fmt/format.h"
 
@@ -195,15 +199,50 @@ namespace ioh
         #pragma warning(push)
         #pragma warning(disable : 4505)
         #endif
+        namespace detail
+        {
+            constexpr std::uint64_t exponent_mask = 0x7ff0000000000000ULL;
+            constexpr std::uint64_t magnitude_mask = 0x7fffffffffffffffULL;
+
+            inline std::uint64_t bits_of(const double x)
+            {
+                std::uint64_t bits;
+                std::memcpy(&bits, &x, sizeof bits);
+                return bits;
+            }
+        }
+
         /**
-         * \brief Checks a vector of doubles for nan values
-         * \param x vector to be checked
+         * \brief Checks a double for nan by its bit pattern. Unlike std::isnan, this is not folded to false when
+         * compiling with -ffast-math, which lets the compiler assume that no value is nan.
+         */
+        inline bool is_nan(const double x)
+        {
+            return (detail::bits_of(x) & detail::magnitude_mask) > detail::exponent_mask;
+        }
+
+        //! Checks a double for inf by its bit pattern, see is_nan
+        inline bool is_inf(const double x)
+        {
+            return (detail::bits_of(x) & detail::magnitude_mask) == detail::exponent_mask;
+        }
+
+        //! Checks that a double is neither nan nor inf by its bit pattern, see is_nan
+        inline bool is_finite(const double x)
+        {
+            return (detail::bits_of(x) & detail::exponent_mask) != detail::exponent_mask;
+        }
+
+        /**
+         * \brief Checks an array of doubles for nan values
+         * \param x pointer to the first element of the array
+         * \param n the number of elements in the array
          * \return true if x contains a nan value
          */
-        inline bool has_nan(const std::vector<double> &x)
+        inline bool has_nan(const double *x, const size_t n)
         {
-            for (const auto &e : x)
-                if (std::isnan(e))
+            for (size_t i = 0; i < n; ++i)
+                if (is_nan(x[i]))
                     return true;
             return false;
         }
@@ -213,25 +252,76 @@ namespace ioh
          * \param x vector to be checked
          * \return true if x contains a nan value
          */
-        inline bool all_finite(const std::vector<double> &x)
+        inline bool has_nan(const std::vector<double> &x)
+        {
+            return has_nan(x.data(), x.size());
+        }
+
+        /**
+         * \brief Checks if all elements of an array of doubles are finite
+         * \param x pointer to the first element of the array
+         * \param n the number of elements in the array
+         * \return true if x contains only finite values
+         */
+        inline bool all_finite(const double *x, const size_t n)
         {
-            for (const auto &e : x)
-                if (!std::isfinite(e))
+            for (size_t i = 0; i < n; ++i)
+                if (!is_finite(x[i]))
                     return false;
             return true;
         }
 
+        /**
+         * \brief Checks if all elements of a vector of doubles are finite
+         * \param x vector to be checked
+         * \return true if x contains only finite values
+         */
+        inline bool all_finite(const std::vector<double> &x)
+        {
+            return all_finite(x.data(), x.size());
+        }
+
+        /**
+        * \brief Checks an array of doubles for inf values
+        * \param x pointer to the first element of the array
+        * \param n the number of elements in the array
+        * \return true if x contains an inf value
+        */
+        inline bool has_inf(const double *x, const size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+                if (is_inf(x[i]))
+                    return true;
+            return false;
+        }
+
         /**
         * \brief Checks a vector of doubles for inf values
         * \param x vector to be checked
-        * \return true if x contains a nan value
+        * \return true if x contains an inf value
         */
         inline bool has_inf(const std::vector<double> &x)
         {
-            for (const auto &e : x)
-                if (std::isinf(e))
-                    return true;
-            return false;
+            return has_inf(x.data(), x.size());
+        }
+
+        /**
+         * \brief Returns a work buffer which is private to the calling thread, such that functions which need
+         * temporary storage remain allocation free and can be called concurrently. The buffer is reused between
+         * calls and only allocates memory when it has to grow. Its contents are unspecified.
+         * \tparam T the type of the elements of the buffer
+         * \tparam Owner the type which uses the buffer
+         * \tparam Index distinguishes several buffers of the same Owner
+         * \param n the size of the buffer
+         * \return a reference to the buffer, which stays valid until the next call with the same template arguments
+         * from the same thread
+         */
+        template <typename T, typename Owner, int Index = 0>
+        std::vector<T> &thread_local_buffer(const size_t n)
+        {
+            thread_local std::vector<T> buffer;
+            buffer.resize(n);
+            return buffer;
         }
         #ifdef _MSC_VER
         #pragma warning(pop)
@@ -5,6 +5,7 @@
 #include "problem/transformation.hpp"
 #include "problem/problem.hpp"
 #include "problem/bbob.hpp"
+#include "problem/large_scale.hpp"
 #include "problem/pbo.hpp"
 
 // #include "problem/python.hpp"
@@ -4,34 +4,40 @@
 
 namespace ioh::problem::bbob
 {
-    class AttractiveSector final : public BBOProblem<AttractiveSector>
+    inline void initialize_f6(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result =  0.0 ;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i) * (1. + 9999.0 * (objective_.x.at(i) * x.at(i) > 0.0));
-            return result;
-        }
+        params.set_offset(params.state.second_transformation_matrix);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    inline void transform_f6(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.second_transformation_matrix, params.offset.data(), x, z.data(), z.size());
+    }
 
-        double transform_objectives(const double y) override
-        {
-            using namespace transformation::objective;
-            return shift(pow(oscillate(y), .9), objective_.y);
-        }
+    inline double evaluate_f6(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::attractive_sector(z, n, params.objective.x.data());
+    }
+
+    inline double objective_f6(const double y, const double *, size_t, const InstanceParams &params)
+    {
+        using namespace transformation::objective;
+        return shift(pow(oscillate(y), .9), params.objective.y);
+    }
+
+    //! AttractiveSector, evaluated at M * (x - xopt), of which the value is oscillated and raised to the power .9
+    inline double f6(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f6, evaluate_f6, objective_f6>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f6{f6, transform_f6, evaluate_f6, objective_f6};
 
+    class AttractiveSector final : public BBOProblem<AttractiveSector>
+    {
     public:
         AttractiveSector(const int instance, const int n_variables) :
-            BBOProblem(6, instance, n_variables, "AttractiveSector")
+            BBOProblem(6, instance, n_variables, "AttractiveSector", stages_f6, initialize_f6)
         {
         }
     };
@@ -2,52 +2,103 @@
 
 #include "ioh/problem/problem.hpp"
 #include "ioh/problem/transformation.hpp"
+#include "ioh/problem/bbob/instance_cache.hpp"
+#include "ioh/problem/bbob/kernels.hpp"
 
 namespace ioh::problem
 {
-    class BBOB : public Real
+    namespace bbob
     {
-    protected:
+        /**
+         * \brief The random rotations and scalings of a BBOB instance, which are shared by all functions
+         */
         struct TransformationState
         {
             long seed;
             std::vector<double> exponents{};
             std::vector<double> conditions{};
-            std::vector<std::vector<double>> transformation_matrix{};
+            common::Matrix<double> transformation_matrix{};
             std::vector<double> transformation_base{};
-            std::vector<std::vector<double>> second_transformation_matrix{};
-            std::vector<std::vector<double>> first_rotation{};
-            std::vector<std::vector<double>> second_rotation{};
+            common::Matrix<double> second_transformation_matrix{};
+            common::Matrix<double> first_rotation{};
+            common::Matrix<double> second_rotation{};
 
             TransformationState(const long problem_id, const int instance, const int n_variables,
                                 const double condition = sqrt(10.0)) :
                 seed((problem_id == 4 || problem_id == 18 ? problem_id - 1 : problem_id) + 10000 * instance),
                 exponents(n_variables),
                 conditions(n_variables),
-                transformation_matrix(n_variables, std::vector<double>(n_variables)),
+                transformation_matrix(n_variables, n_variables),
                 transformation_base(n_variables),
-                second_transformation_matrix(n_variables, std::vector<double>(n_variables)),
-                first_rotation(compute_rotation(seed + 1000000, n_variables)),
-                second_rotation(compute_rotation(seed, n_variables))
+                second_transformation_matrix(n_variables, n_variables),
+                first_rotation(n_variables, n_variables),
+                second_rotation(n_variables, n_variables)
             {
                 for (auto i = 0; i < n_variables; ++i)
                     exponents[i] = static_cast<double>(i) / (static_cast<double>(n_variables) - 1);
 
+                bbob::InstanceCache::Header header;
+                header.problem_id = static_cast<std::int32_t>(problem_id);
+                header.instance = instance;
+                header.n_variables = n_variables;
+                header.seed = seed;
+                header.condition = condition;
+
+                if (!InstanceCache::load(
+                        header, {&first_rotation, &second_rotation, &second_transformation_matrix}))
+                {
+                    first_rotation = compute_rotation(seed + 1000000, n_variables);
+                    second_rotation = compute_rotation(seed, n_variables);
+                    second_transformation_matrix = common::Matrix<double>(n_variables, n_variables);
+                    compute_second_transformation_matrix(condition, n_variables);
+                    InstanceCache::store(
+                        header, {&first_rotation, &second_rotation, &second_transformation_matrix});
+                }
                 transformation_matrix = first_rotation;
+            }
 
-                for (auto i = 0; i < n_variables; ++i)
-                    for (auto j = 0; j < n_variables; ++j)
-                        for (auto k = 0; k < n_variables; ++k)
-                            second_transformation_matrix[i][j] += first_rotation.at(i).at(k)
-                                * pow(condition, exponents.at(k))
-                                * second_rotation.at(k).at(j);
+            /**
+             * \brief Computes first_rotation * diag(condition^exponents) * second_rotation. The scaling is applied
+             * once per row of first_rotation, and the product is accumulated row by row in blocks of columns that
+             * fit in cache. Every element is still summed over k in ascending order, so the result is bit-identical
+             * to the straightforward triple loop.
+             */
+            void compute_second_transformation_matrix(const double condition, const int n_variables)
+            {
+                constexpr auto block_size = 256;
+                const auto n = static_cast<size_t>(n_variables);
+
+                std::vector<double> scales(n);
+                for (size_t k = 0; k < n; ++k)
+                    scales[k] = pow(condition, exponents[k]);
+
+                std::vector<double> scaled_row(n);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    const auto *rotation_row = first_rotation[i];
+                    for (size_t k = 0; k < n; ++k)
+                        scaled_row[k] = rotation_row[k] * scales[k];
+
+                    auto *result_row = second_transformation_matrix[i];
+                    for (size_t jb = 0; jb < n; jb += block_size)
+                    {
+                        const auto je = std::min(n, jb + block_size);
+                        for (size_t k = 0; k < n; ++k)
+                        {
+                            const auto a = scaled_row[k];
+                            const auto *b = second_rotation[k];
+                            for (auto j = jb; j < je; ++j)
+                                result_row[j] += a * b[j];
+                        }
+                    }
+                }
             }
 
             [[nodiscard]]
-            std::vector<std::vector<double>> compute_rotation(const long rotation_seed, const int n_variables) const
+            common::Matrix<double> compute_rotation(const long rotation_seed, const int n_variables) const
             {
                 const auto random_vector = common::random::bbob2009::normal(n_variables * n_variables, rotation_seed);
-                auto matrix = std::vector<std::vector<double>>(n_variables, std::vector<double>(n_variables));
+                auto matrix = common::Matrix<double>(n_variables, n_variables);
 
                 // reshape
                 for (auto i = 0; i < n_variables; i++)
@@ -76,24 +127,347 @@ namespace ioh::problem
                 }
                 return matrix;
             }
-        } transformation_state_;
+        };
+
+        /**
+         * \brief Draws the optimum of a BBOB instance, before the functions adjust it to their landscapes
+         * \param problem_id the id of the problem
+         * \param seed the seed of the instance
+         * \param n_variables the dimension of the problem
+         */
+        [[nodiscard]]
+        inline Solution<double> calculate_objective(const int problem_id, const long seed, const int n_variables)
+        {
+            using namespace common::random::bbob2009;
+
+            auto x = uniform(n_variables, seed + (1000000 * (problem_id == 12)));
+
+            for (auto &xi : x)
+            {
+                xi = 8 * floor(1e4 * xi) / 1e4 - 4;
+                if (xi == 0.0)
+                    xi = -1e-5;
+            }
+
+            const auto r1 = normal(1, seed).at(0);
+            const auto r2 = normal(1, seed + 1).at(0);
+
+            return {x, std::min(1000., std::max(-1000., floor((100. * 100. * r1 / r2) + 0.5) / 100.))};
+        }
+
+        /**
+         * \brief Everything a BBOB function needs to evaluate a solution. The parameters are constructed once per
+         * instance, completed by the initializer of the function, and never modified afterwards, so a function can
+         * be called with the same parameters from any number of threads. The fields which a function does not use
+         * are left empty.
+         */
+        struct InstanceParams
+        {
+            int problem_id;
+            int instance;
+            int n_variables;
+            TransformationState state;
+
+            //! The optimum of the instance, xopt and fopt
+            Solution<double> objective;
+
+            //! -M * xopt, which folds the subtraction of the optimum into the first affine transformation
+            std::vector<double> offset{};
+
+            //! The coefficients of an element-wise transformation, such as asymmetric, brs or the signs of Schwefel
+            std::vector<double> coefficients{};
+
+            //! The factors of the conditioning, or the weights of the function
+            std::vector<double> factors{};
+
+            //! A scalar of the function, such as the scaling of the Rosenbrock functions
+            double factor = 1.0;
+
+            //! The exponent of Katsuura
+            double exponent = 1.0;
+
+            //! The weight of the penalty on the boundary
+            double penalty_factor = 0.0;
+
+            //! The number of dimensions of the sharp ridge
+            int n_linear_dimensions = 0;
+
+            //! The peaks of the Gallagher functions
+            kernels::GallagherPeaks peaks{};
+
+            InstanceParams(const int problem_id, const int instance, const int n_variables,
+                           const double condition = sqrt(10.0)) :
+                problem_id(problem_id), instance(instance), n_variables(n_variables),
+                state(problem_id, instance, n_variables, condition),
+                objective(calculate_objective(problem_id, state.seed, n_variables))
+            {
+            }
+
+            /**
+             * \brief Sets offset to -m * xopt. Used as the transformation vector of affine, this folds the
+             * subtraction of the optimum into the matrix product: m * x - m * xopt is exactly zero at the optimum,
+             * since both products are computed by the same kernel.
+             * \param m the matrix of the first affine transformation which follows the subtraction of xopt
+             */
+            void set_offset(const common::Matrix<double> &m)
+            {
+                const auto n = static_cast<size_t>(n_variables);
+                offset.resize(n);
+                common::simd::affine(m.data(), m.stride(), nullptr, objective.x.data(), offset.data(), n, n,
+                                     [](size_t, const double value) { return -value; });
+            }
+        };
+
+        /**
+         * \brief A BBOB function, which evaluates x, including every transformation of the variables and of the
+         * objective value. It has no side effects besides the use of work space which is private to the calling
+         * thread.
+         */
+        using Function = double (*)(const double *x, size_t n, const InstanceParams &params);
+
+        //! Completes the parameters of an instance for a specific function
+        using Initializer = void (*)(InstanceParams &params);
+
+        //! The first stage of a function, which writes the transformed variables of x to z
+        using VariablesTransformation = void (*)(const double *x, std::vector<double> &z, const InstanceParams &params);
+
+        //! The second stage of a function, which computes the raw value of the transformed variables z
+        using Evaluation = double (*)(const double *z, size_t n, const InstanceParams &params);
+
+        /**
+         * \brief The last stage of a function, which shifts the raw value y by fopt, and adds the penalty of x
+         * outside of the domain if the function has one
+         */
+        using ObjectiveTransformation = double (*)(double y, const double *x, size_t n, const InstanceParams &params);
+
+        /**
+         * \brief A function together with its stages, which a problem runs as transform_variables, evaluate and
+         * transform_objectives, such that state().current_internal holds the transformed variables and the raw
+         * value. A function without a transformation of the variables, or of the objective value, has nullptr as
+         * that stage.
+         */
+        struct Stages
+        {
+            Function function;
+            VariablesTransformation transform_variables;
+            Evaluation evaluate;
+            ObjectiveTransformation transform_objectives;
+        };
+
+        /**
+         * \brief Work space of the functions, which is private to the calling thread
+         * \tparam Index distinguishes the buffers which are used at the same time
+         */
+        template <int Index = 0>
+        std::vector<double> &buffer(const size_t n)
+        {
+            return common::thread_local_buffer<double, InstanceParams, Index>(n);
+        }
+
+        /**
+         * \brief Computes out = op(m * x + b), see common::simd::affine
+         * \param m the transformation matrix
+         * \param b the transformation vector, or nullptr for a linear transformation
+         * \param x the variables
+         * \param out the transformed variables, which should not overlap with x
+         * \param n the number of variables
+         * \param op element-wise operation op(i, xi), applied to the transformed variables
+         */
+        template <typename Op = common::simd::Identity>
+        void transform(const common::Matrix<double> &m, const double *b, const double *x, double *out,
+                       const size_t n, const Op &op = {})
+        {
+            common::simd::affine(m.data(), m.stride(), b, x, out, n, n, op);
+        }
+
+        //! Computes z = x - xopt
+        inline void subtract_optimum(const double *x, std::vector<double> &z, const InstanceParams &params)
+        {
+            for (size_t i = 0; i < z.size(); ++i)
+                z[i] = x[i] - params.objective.x[i];
+        }
+
+        //! Shifts the raw value by fopt
+        inline double shift_objective(const double y, const double *, size_t, const InstanceParams &params)
+        {
+            return transformation::objective::shift(y, params.objective.y);
+        }
+
+        //! Shifts the raw value by fopt, and adds penalty_factor times the penalty of x outside of the domain
+        inline double shift_and_penalize(const double y, const double *x, const size_t n, const InstanceParams &params)
+        {
+            return y + params.objective.y + params.penalty_factor * kernels::boundary_penalty(x, n);
+        }
+
+        /**
+         * \brief Evaluates x by running the stages of a function one after the other. The transformed variables are
+         * kept in the third buffer, so the stages can use the first two as work space.
+         */
+        template <VariablesTransformation TransformVariables, Evaluation Evaluate,
+                  ObjectiveTransformation TransformObjectives>
+        double evaluate_stages(const double *x, const size_t n, const InstanceParams &params)
+        {
+            auto y = 0.0;
+            if constexpr (TransformVariables != nullptr)
+            {
+                auto &z = buffer<2>(n);
+                TransformVariables(x, z, params);
+                y = Evaluate(z.data(), n, params);
+            }
+            else
+                y = Evaluate(x, n, params);
+
+            if constexpr (TransformObjectives != nullptr)
+                return TransformObjectives(y, x, n, params);
+            else
+                return y;
+        }
+    }
+
+    /**
+     * \brief The BBOB problems. Every problem is a thin wrapper around the bbob::Stages of a pure bbob::Function
+     * and the bbob::InstanceParams of its instance, which are shared between clones of a problem. The functions can
+     * also be used without a problem:
+     *
+     *     bbob::InstanceParams params(21, 1, n);
+     *     bbob::initialize_f21(params);
+     *     const auto y = bbob::f21(x, n, params);
+     *
+     * A problem runs the stages of its function in its evaluation pipeline, so state().current_internal holds the
+     * transformed solution and its value without fopt. Problems which are constructed without stages, such as
+     * subclasses written against the BBOB interface before the functions were introduced, override evaluate and
+     * transform_variables instead.
+     */
+    class BBOB : public Real
+    {
+    protected:
+        using TransformationState = bbob::TransformationState;
+
+        //! Owns the transformation state, which is shared between clones of a problem
+        std::shared_ptr<TransformationState> shared_transformation_state_;
+
+        /**
+         * \brief The transformation state, which is immutable once the problem is constructed. It points into
+         * shared_transformation_state_, rather than referring to it, so that the problems are copy assignable.
+         */
+        TransformationState *transformation_state_;
+
+        //! Owns the parameters of the instance, which are shared between clones of a problem
+        std::shared_ptr<const bbob::InstanceParams> params_;
+
+        //! The stages of the function of the problem, which are nullptr when a subclass overrides evaluate
+        bbob::Stages stages_;
+
+        double evaluate(const std::vector<double> &x) override
+        {
+            return stages_.evaluate(x.data(), x.size(), *params_);
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            if (stages_.transform_variables == nullptr)
+                return x;
 
+            auto &z = transformation_buffer();
+            stages_.transform_variables(x.data(), z, *params_);
+            x.swap(z);
+            return x;
+        }
+
+        //! Shifts the objective value by fopt, and penalizes the current solution if the function does so
         double transform_objectives(const double y) override
         {
-            return transformation::objective::shift(y, objective_.y);
+            if (stages_.function == nullptr)
+                return transformation::objective::shift(y, objective_.y);
+            if (stages_.transform_objectives == nullptr)
+                return y;
+
+            const auto &x = current().x;
+            return stages_.transform_objectives(y, x.data(), x.size(), *params_);
         }
 
-    public:
+        /**
+         * \brief Work space for the out of place transformations, such as transformation::variables::affine,
+         * which is private to the calling thread
+         */
+        [[nodiscard]]
+        std::vector<double> &transformation_buffer() const
+        {
+            return common::thread_local_buffer<double, BBOB>(meta_data_.n_variables);
+        }
+
+        /**
+         * \brief Computes -m * xopt, see bbob::InstanceParams::set_offset
+         * \param m the matrix of the first affine transformation which follows the subtraction of xopt
+         */
+        [[nodiscard]]
+        std::vector<double> objective_offset(const common::Matrix<double> &m) const
+        {
+            const auto n = static_cast<size_t>(meta_data_.n_variables);
+            std::vector<double> offset(n);
+            common::simd::affine(m.data(), m.stride(), nullptr, objective_.x.data(), offset.data(), n, n,
+                                 [](size_t, const double value) { return -value; });
+            return offset;
+        }
+
+        static std::shared_ptr<bbob::InstanceParams> make_params(const int problem_id, const int instance,
+                                                                 const int n_variables,
+                                                                 const bbob::Initializer initialize,
+                                                                 const double condition)
+        {
+            auto params = std::make_shared<bbob::InstanceParams>(problem_id, instance, n_variables, condition);
+            if (initialize != nullptr)
+                initialize(*params);
+            return params;
+        }
+
+    private:
         BBOB(const int problem_id, const int instance, const int n_variables, const std::string &name,
-             const double condition = sqrt(10.0)):
+             std::shared_ptr<bbob::InstanceParams> params, const bbob::Stages &stages) :
             Real(MetaData(problem_id, instance, name, n_variables, common::OptimizationType::Minimization),
                  Constraint<double>(n_variables, 5, -5)),
-            transformation_state_(problem_id, instance, n_variables, condition)
+            shared_transformation_state_(params, &params->state),
+            transformation_state_(shared_transformation_state_.get()),
+            params_(std::move(params)), stages_(stages)
         {
-            objective_ = calculate_objective();
+            objective_ = params_->objective;
             log_info_.objective = objective_;
         }
 
+    public:
+        /**
+         * \param problem_id the id of the problem
+         * \param instance the instance of the problem
+         * \param n_variables the dimension of the problem
+         * \param name the name of the problem
+         * \param stages the function of the problem and its stages
+         * \param initialize the initializer of the parameters of the function, if it needs any
+         * \param condition the condition of the second transformation matrix
+         */
+        BBOB(const int problem_id, const int instance, const int n_variables, const std::string &name,
+             const bbob::Stages &stages, const bbob::Initializer initialize = nullptr,
+             const double condition = sqrt(10.0)) :
+            BBOB(problem_id, instance, n_variables, name,
+                 make_params(problem_id, instance, n_variables, initialize, condition), stages)
+        {
+        }
+
+        /**
+         * \brief Constructs a problem without a function, of which the subclass overrides evaluate and
+         * transform_variables, and completes transformation_state_ in its constructor
+         * \param problem_id the id of the problem
+         * \param instance the instance of the problem
+         * \param n_variables the dimension of the problem
+         * \param name the name of the problem
+         * \param condition the condition of the second transformation matrix
+         */
+        BBOB(const int problem_id, const int instance, const int n_variables, const std::string &name,
+             const double condition = sqrt(10.0)) :
+            BBOB(problem_id, instance, n_variables, name,
+                 make_params(problem_id, instance, n_variables, nullptr, condition), bbob::Stages{})
+        {
+        }
+
         void update_log_info() override
         {
             log_info_.evaluations = static_cast<size_t>(state_.evaluations);
@@ -104,25 +478,38 @@ namespace ioh::problem
             log_info_.current.y = log_info_.current.y - objective_.y;
         }
 
+        //! The parameters of the instance
         [[nodiscard]]
-        Solution<double> calculate_objective() const
-        {
-            using namespace common::random::bbob2009;
+        const bbob::InstanceParams &params() const { return *params_; }
 
-            auto x = uniform(meta_data_.n_variables,
-                             transformation_state_.seed + (1000000 * (meta_data_.problem_id == 12)));
+        //! The parameters of the instance, which can outlive the problem
+        [[nodiscard]]
+        std::shared_ptr<const bbob::InstanceParams> shared_params() const { return params_; }
 
-            for (auto &xi : x)
-            {
-                xi = 8 * floor(1e4 * xi) / 1e4 - 4;
-                if (xi == 0.0)
-                    xi = -1e-5;
-            }
+        //! The function of the problem, which can be called as function()(x, n, params())
+        [[nodiscard]]
+        bbob::Function function() const { return stages_.function; }
 
-            const auto r1 = normal(1, transformation_state_.seed).at(0);
-            const auto r2 = normal(1, transformation_state_.seed + 1).at(0);
+        //! The stages of the function of the problem
+        [[nodiscard]]
+        const bbob::Stages &stages() const { return stages_; }
 
-            return {x, std::min(1000., std::max(-1000., floor((100. * 100. * r1 / r2) + 0.5) / 100.))};
+        [[nodiscard]]
+        Solution<double> calculate_objective() const
+        {
+            return calculate_objective(meta_data_.problem_id, params_->state.seed, meta_data_.n_variables);
+        }
+
+        /**
+         * \brief Draws the optimum of a BBOB instance, before the functions adjust it to their landscapes
+         * \param problem_id the id of the problem
+         * \param seed the seed of the instance
+         * \param n_variables the dimension of the problem
+         */
+        [[nodiscard]]
+        static Solution<double> calculate_objective(const int problem_id, const long seed, const int n_variables)
+        {
+            return bbob::calculate_objective(problem_id, seed, n_variables);
         }
     };
 
@@ -132,10 +519,23 @@ namespace ioh::problem
                        AutomaticProblemRegistration<ProblemType, Real>
     {
     public:
+        BBOProblem(const int problem_id, const int instance, const int n_variables, const std::string &name,
+                   const bbob::Stages &stages, const bbob::Initializer initialize = nullptr,
+                   const double condition = sqrt(10.0)) :
+            BBOB(problem_id, instance, n_variables, name, stages, initialize, condition)
+        {
+        }
+
         BBOProblem(const int problem_id, const int instance, const int n_variables, const std::string &name,
                    const double condition = sqrt(10.0)) :
             BBOB(problem_id, instance, n_variables, name, condition)
         {
         }
+
+        [[nodiscard]]
+        std::unique_ptr<Real> clone() const override
+        {
+            return std::make_unique<ProblemType>(static_cast<const ProblemType &>(*this));
+        }
     };
 }
@@ -4,32 +4,38 @@
 
 namespace ioh::problem::bbob
 {
-    class BentCigar final : public BBOProblem<BentCigar>
+    inline void initialize_f12(InstanceParams &params)
+    {
+        params.set_offset(params.state.transformation_matrix);
+    }
 
+    inline void transform_f12(const double *x, std::vector<double> &z, const InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto condition = 1.0e6;
-            auto result = x.at(0) * x.at(0);
-            for (auto i = 1; i < meta_data_.n_variables; ++i)
-                result += condition * x.at(i) * x.at(i);
-            return result;
-        }
+        const auto n = z.size();
+        const auto &m = params.state.transformation_matrix;
+        auto &y = buffer(n);
+        transform(m, params.offset.data(), x, y.data(), n, transformation::variables::Asymmetric(0.5, n));
+        transform(m, nullptr, y.data(), z.data(), n);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            asymmetric(x, 0.5);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    inline double evaluate_f12(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::bent_cigar(z, n);
+    }
+
+    //! BentCigar, evaluated at M * asymmetric(M * (x - xopt))
+    inline double f12(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f12, evaluate_f12, shift_objective>(x, n, params);
+    }
 
+    inline constexpr Stages stages_f12{f12, transform_f12, evaluate_f12, shift_objective};
+
+    class BentCigar final : public BBOProblem<BentCigar>
+    {
     public:
         BentCigar(const int instance, const int n_variables) :
-            BBOProblem(12, instance, n_variables, "BentCigar")
+            BBOProblem(12, instance, n_variables, "BentCigar", stages_f12, initialize_f12)
         {
         }
     };
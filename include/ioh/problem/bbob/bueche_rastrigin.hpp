@@ -4,34 +4,41 @@
 
 namespace ioh::problem::bbob
 {
-    class BuecheRastrigin final : public RastriginBase<BuecheRastrigin>
+    inline void initialize_f4(InstanceParams &params)
     {
-        const double penalty_factor_ = 100.0;
+        params.coefficients = transformation::variables::brs_factors(static_cast<size_t>(params.n_variables));
+        params.penalty_factor = 100.0;
+        for (size_t i = 0; i < params.objective.x.size(); i += 2)
+            params.objective.x[i] = fabs(params.objective.x[i]);
+    }
 
-    protected:
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            oscillate(x);
-            brs(x);
-            return x;
-        }
+    inline void transform_f4(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        using namespace transformation::variables;
+        subtract_optimum(x, z, params);
+        oscillate(z);
+        brs(z, params.coefficients);
+    }
 
-        double transform_objectives(const double y) override
-        {
-            using namespace transformation::objective;
-            return penalize(state_.current.x, constraint_, penalty_factor_,shift(y, objective_.y));
-        }
+    inline double evaluate_f4(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::rastrigin(z, n);
+    }
+
+    //! Rastrigin, evaluated at brs(oscillate(x - xopt)) and penalized outside of the domain
+    inline double f4(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f4, evaluate_f4, shift_and_penalize>(x, n, params);
+    }
 
+    inline constexpr Stages stages_f4{f4, transform_f4, evaluate_f4, shift_and_penalize};
+
+    class BuecheRastrigin final : public BBOProblem<BuecheRastrigin>
+    {
     public:
         BuecheRastrigin(const int instance, const int n_variables) :
-            RastriginBase(4, instance, n_variables, "BuecheRastrigin")
+            BBOProblem(4, instance, n_variables, "BuecheRastrigin", stages_f4, initialize_f4)
         {
-            for (size_t i = 0; i < objective_.x.size(); i += 2)
-            {
-                objective_.x[i] = fabs(objective_.x[i]);
-            }
         }
     };
 }
@@ -4,32 +4,39 @@
 
 namespace ioh::problem::bbob
 {
-    class DifferentPowers final : public BBOProblem<DifferentPowers>
+    //! The exponents 2 + 4 * i / (n - 1), as coefficients
+    inline void initialize_f14(InstanceParams &params)
+    {
+        params.set_offset(params.state.transformation_matrix);
+        params.coefficients.resize(static_cast<size_t>(params.n_variables));
+        for (auto i = 0; i < params.n_variables; ++i)
+            params.coefficients[i] = 2.0 + 4.0 * params.state.exponents.at(i);
+    }
 
+    inline void transform_f14(const double *x, std::vector<double> &z, const InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto sum = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                sum += pow(fabs(x.at(i)), transformation_state_.exponents.at(i));
-            return sqrt(sum);
-        }
+        transform(params.state.transformation_matrix, params.offset.data(), x, z.data(), z.size());
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    inline double evaluate_f14(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::different_powers(z, n, params.coefficients.data());
+    }
+
+    //! DifferentPowers, evaluated at M * (x - xopt)
+    inline double f14(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f14, evaluate_f14, shift_objective>(x, n, params);
+    }
 
+    inline constexpr Stages stages_f14{f14, transform_f14, evaluate_f14, shift_objective};
+
+    class DifferentPowers final : public BBOProblem<DifferentPowers>
+    {
     public:
         DifferentPowers(const int instance, const int n_variables) :
-            BBOProblem(14, instance, n_variables, "DifferentPowers")
+            BBOProblem(14, instance, n_variables, "DifferentPowers", stages_f14, initialize_f14)
         {
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                transformation_state_.exponents[i] = 2.0 + 4.0 * transformation_state_.exponents.at(i);
         }
     };
 }
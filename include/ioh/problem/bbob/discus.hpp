@@ -4,30 +4,35 @@
 
 namespace ioh::problem::bbob
 {
-    class Discus final : public BBOProblem<Discus>
+    inline void initialize_f11(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto condition = 1.0e6;
-            auto result = condition * x.at(0) * x.at(0);
-            for (auto i = 1; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i);
-            return result;
-        }
+        params.set_offset(params.state.transformation_matrix);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            oscillate(x);
-            return x;
-        }
+    inline void transform_f11(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.transformation_matrix, params.offset.data(), x, z.data(), z.size(),
+                  transformation::variables::Oscillate{});
+    }
 
+    inline double evaluate_f11(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::discus(z, n);
+    }
+
+    //! Discus, evaluated at oscillate(M * (x - xopt))
+    inline double f11(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f11, evaluate_f11, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f11{f11, transform_f11, evaluate_f11, shift_objective};
+
+    class Discus final : public BBOProblem<Discus>
+    {
     public:
         Discus(const int instance, const int n_variables) :
-            BBOProblem(11, instance, n_variables, "Discus")
+            BBOProblem(11, instance, n_variables, "Discus", stages_f11, initialize_f11)
         {
         }
     };
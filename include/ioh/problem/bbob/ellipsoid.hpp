@@ -4,42 +4,38 @@
 
 namespace ioh::problem::bbob
 {
-    template <typename T>
-    class EllipsoidBase : public BBOProblem<T>
+    //! The conditions 10^6^(i / (n - 1)) of the ellipsoids
+    inline void initialize_f2(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result = x.at(0) * x.at(0);
-            for (auto i = 1; i < this->meta_data_.n_variables; ++i)
-                result += this->transformation_state_.conditions.at(i) * x.at(i) * x.at(i);
-            return result;
-        }
+        static const auto condition = 1.0e6;
+        for (auto i = 1; i < params.n_variables; ++i)
+            params.state.conditions[i] = pow(condition, params.state.exponents.at(i));
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, this->objective_.x);
-            oscillate(x);
-            return x;
-        }
+    inline void transform_f2(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        subtract_optimum(x, z, params);
+        transformation::variables::oscillate(z);
+    }
 
-    public:
-        EllipsoidBase(const int problem_id, const int instance, const int n_variables, const std::string &name) :
-            BBOProblem<T>(problem_id, instance, n_variables, name)
-           
-        {
-            static const auto condition = 1.0e6;
-            for (auto i = 1; i < this->meta_data_.n_variables; ++i)
-                this->transformation_state_.conditions[i] = pow(condition, this->transformation_state_.exponents.at(i));
-        }
-    };
+    inline double evaluate_f2(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::ellipsoid(z, n, params.state.conditions.data());
+    }
+
+    //! Ellipsoid, evaluated at oscillate(x - xopt)
+    inline double f2(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f2, evaluate_f2, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f2{f2, transform_f2, evaluate_f2, shift_objective};
 
-    class Ellipsoid final : public EllipsoidBase<Ellipsoid>
+    class Ellipsoid final : public BBOProblem<Ellipsoid>
     {
     public:
         Ellipsoid(const int instance, const int n_variables) :
-            EllipsoidBase(2, instance, n_variables, "Ellipsoid")
+            BBOProblem(2, instance, n_variables, "Ellipsoid", stages_f2, initialize_f2)
         {
         }
     };
@@ -4,27 +4,37 @@
 
 namespace ioh::problem::bbob
 {
-    class EllipsoidRotated final : public EllipsoidBase<EllipsoidRotated>
+    inline void initialize_f10(InstanceParams &params)
+    {
+        initialize_f2(params);
+        params.set_offset(params.state.transformation_matrix);
+    }
 
+    inline void transform_f10(const double *x, std::vector<double> &z, const InstanceParams &params)
     {
-    protected:
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix,
-                                                    transformation_state_.transformation_base);
-            oscillate(x);
-            return x;
-        }
+        transform(params.state.transformation_matrix, params.offset.data(), x, z.data(), z.size(),
+                  transformation::variables::Oscillate{});
+    }
+
+    inline double evaluate_f10(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::ellipsoid(z, n, params.state.conditions.data());
+    }
 
+    //! Ellipsoid, evaluated at oscillate(M * (x - xopt))
+    inline double f10(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f10, evaluate_f10, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f10{f10, transform_f10, evaluate_f10, shift_objective};
+
+    class EllipsoidRotated final : public BBOProblem<EllipsoidRotated>
+    {
     public:
         EllipsoidRotated(const int instance, const int n_variables) :
-            EllipsoidBase(10, instance, n_variables, "EllipsoidRotated")
+            BBOProblem(10, instance, n_variables, "EllipsoidRotated", stages_f10, initialize_f10)
         {
-            static const auto condition = 1.0e6;
-            for (auto i = 1; i < meta_data_.n_variables; ++i)
-                transformation_state_.conditions[i] = pow(condition, transformation_state_.exponents.at(i));
         }
     };
 }
@@ -4,145 +4,137 @@
 
 namespace ioh::problem::bbob
 {
-    template <typename T>
-    class Gallagher : public BBOProblem<T>
+    namespace gallagher
     {
-        struct Peak
+        /**
+         * \brief The indices 0..n-1, sorted by the uniform random numbers drawn for them
+         * \param n the number of indices
+         * \param seed the seed for the random numbers
+         */
+        inline std::vector<int> sorted_indices(const int n, const int seed)
         {
-            double value;
-            std::vector<double> scales;
+            const auto random_numbers = common::random::bbob2009::uniform(n, seed);
+            std::vector<std::pair<double, int>> permutations(n);
 
-            struct Permutation
-            {
-                double value;
-                int index;
+            for (auto i = 0; i < n; ++i)
+                permutations[i] = {random_numbers.at(i), i};
 
-                bool operator<(const Permutation &b) const
-                {
-                    return value < b.value;
-                }
+            std::sort(permutations.begin(), permutations.end(),
+                      [](const auto &a, const auto &b) { return a.first < b.first; });
 
-                static std::vector<Permutation> sorted(const int n, const int seed)
-                {
-                    const auto random_numbers = common::random::bbob2009::uniform(n, seed);
-                    std::vector<Permutation> permutations(n);
+            std::vector<int> indices(n);
+            for (auto i = 0; i < n; ++i)
+                indices[i] = permutations[i].second;
+            return indices;
+        }
 
-                    for (auto i = 0; i < n; ++i)
-                        permutations[i] = {random_numbers.at(i), i};
+        /**
+         * \brief Computes the scales of a peak
+         * \param scales the row of the peak in GallagherPeaks::scales
+         * \param seed the seed of the peak
+         * \param n_variables the dimension of the problem
+         * \param condition the condition of the peak
+         */
+        inline void peak_scales(double *scales, const int seed, const int n_variables, const double condition)
+        {
+            const auto indices = sorted_indices(n_variables, seed);
+            for (auto i = 0; i < n_variables; ++i)
+                scales[i] = pow(condition,
+                                static_cast<double>(indices[i]) / (static_cast<double>(n_variables) - 1.) - 0.5);
+        }
 
-                    std::sort(permutations.begin(), permutations.end());
-                    return permutations;
-                }
-            };
+        /**
+         * \brief Generates the heights and shapes of the peaks of a Gallagher function. The centers are left at
+         * zero, since they depend on the rotation of the problem.
+         * \param n the number of peaks
+         * \param n_variables the dimension of the problem
+         * \param seed the seed of the instance
+         * \param max_condition the condition of the global peak
+         */
+        inline kernels::GallagherPeaks peaks(const int n, const int n_variables, const int seed,
+                                             const double max_condition)
+        {
+            static const auto f0 = 1.1, f1 = 9.1, mc = 1000.;
+            const auto divisor = static_cast<double>(n) - 2.;
 
-            Peak(const double value, const int seed, const int n_variables, const double condition) :
-                value(value), scales(n_variables)
-            {
-                auto permutations = Permutation::sorted(n_variables, seed);
-                for (auto i = 0; i < n_variables; ++i)
-                    scales[i] = pow(condition,
-                                    static_cast<double>(permutations[i].index) / (static_cast<double>(n_variables) - 1.)
-                                    - 0.5);
-            }
+            const auto indices = sorted_indices(n - 1, seed);
 
-            static std::vector<Peak> get_peaks(const int n, const int n_variables, const int seed, const double max_condition)
+            kernels::GallagherPeaks peaks(static_cast<size_t>(n), static_cast<size_t>(n_variables));
+            peaks.values[0] = 10.0;
+            peak_scales(peaks.scales[0], seed, n_variables, max_condition);
+            for (auto i = 1; i < n; ++i)
             {
-                static const auto f0 = 1.1, f1 = 9.1, mc = 1000.;
-                static const auto divisor = static_cast<double>(n) - 2.;
-
-                auto permutations = Permutation::sorted(n - 1, seed);
-
-                std::vector<Peak> peaks(1, {10.0, seed, n_variables, max_condition});
-                for (auto i = 1; i < n; ++i)
-                    peaks.emplace_back(static_cast<double>(i - 1) / divisor * (f1 - f0) + f0, seed + (1000 * i),
-                                       n_variables,
-                                       pow(mc, static_cast<double>(permutations[i - 1].index) / divisor));
-
-                return peaks;
+                peaks.values[i] = static_cast<double>(i - 1) / divisor * (f1 - f0) + f0;
+                peak_scales(peaks.scales[i], seed + (1000 * i), n_variables,
+                            pow(mc, static_cast<double>(indices[i - 1]) / divisor));
             }
-        };
-
-        std::vector<std::vector<double>> x_transformation_;
-        std::vector<Peak> peaks_;
-        double factor_;
 
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto a = 0.1;
-            std::vector<double> x_transformed(this->meta_data_.n_variables);
-            auto penalty = 0.;
+            for (auto i = 0; i < n; ++i)
+                peaks.log_values[i] = log(peaks.values[i]);
+            return peaks;
+        }
+    }
+
+    /**
+     * \brief Places the peaks and the optimum of a Gallagher function
+     * \param params the parameters of the instance
+     * \param number_of_peaks the number of peaks
+     * \param b the width of the domain of the peaks
+     * \param c the offset of the domain of the peaks
+     * \param max_condition the condition of the global peak
+     */
+    inline void initialize_gallagher(InstanceParams &params, const int number_of_peaks, const double b,
+                                     const double c, const double max_condition)
+    {
+        const auto n_variables = params.n_variables;
+        const auto &rotation = params.state.second_rotation;
+        auto &peaks = params.peaks;
 
-            for (auto i = 0; i < this->meta_data_.n_variables; i++)
-            {
-                const auto out_of_bounds = fabs(x.at(i)) - 5.;
-                if (out_of_bounds > 0.)
-                    penalty += out_of_bounds * out_of_bounds;
+        peaks = gallagher::peaks(number_of_peaks, n_variables, params.state.seed, max_condition);
+        params.factor = -0.5 / static_cast<double>(n_variables);
+        params.penalty_factor = 1.0;
 
-                x_transformed[i] = std::inner_product(x.begin(), x.end(),
-                                                      this->transformation_state_.second_rotation.at(i).begin(), 0.0);
-            }
-#if defined(__GNUC__)
-            #pragma GCC diagnostic push
-            #pragma GCC diagnostic ignored "-Wsequence-point"
-#endif
-            auto result = 10. - std::accumulate(
-                peaks_.begin(), peaks_.end(), 0.0,
-                [&, i = 0](const double sum, const Peak &peak) mutable
-                {
-                    const auto z = std::accumulate(
-                        x_transformed.begin(), x_transformed.end(), 0.0,
-                        [&, j = 0](const double lhs, const double rhs) mutable
-                        {
-                            return lhs + peaks_.at(i).scales.at(j) * pow(rhs - x_transformation_.at(j++).at(i), 2.0);
-                        });
-                    i++;
-                    return std::max(sum, peak.value * exp(factor_ * z));
-                });
-#if defined(__GNUC__)
-            #pragma GCC diagnostic pop
-#endif
-
-            if (result > 0)
-            {
-                result = log(result) / a;
-                result = pow(exp(result + 0.49 * (sin(result) + sin(0.79 * result))), a);
-            }
-            else if (result < 0)
+        const auto random_numbers = common::random::bbob2009::uniform(n_variables * number_of_peaks,
+                                                                      params.state.seed);
+        for (auto i = 0; i < n_variables; ++i)
+        {
+            params.objective.x[i] = 0.8 * (b * random_numbers[i] - c);
+            for (auto j = 0; j < number_of_peaks; ++j)
             {
-                result = log(-result) / a;
-                result = -pow(exp(result + 0.49 * (sin(0.55 * result) + sin(0.31 * result))), a);
+                for (auto k = 0; k < n_variables; ++k)
+                    peaks.centers[j][i] += rotation[i][k] * (b * random_numbers.at(j * n_variables + k) - c);
+                if (j == 0)
+                    peaks.centers[j][i] *= 0.8;
             }
-
-            return result * result + penalty;
         }
+    }
+
+    inline void initialize_f21(InstanceParams &params) { initialize_gallagher(params, 101, 10., 5.0, sqrt(1000.)); }
+
+    inline double evaluate_f21(const double *x, const size_t n, const InstanceParams &params)
+    {
+        auto &z = buffer(n);
+        transform(params.state.second_rotation, nullptr, x, z.data(), n);
+        return kernels::gallagher(z.data(), n, params.peaks, params.factor) +
+            params.penalty_factor * kernels::boundary_penalty(x, n);
+    }
+
+    //! Gallagher, evaluated at R * x and penalized outside of the domain
+    inline double f21(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<nullptr, evaluate_f21, shift_objective>(x, n, params);
+    }
 
+    inline constexpr Stages stages_f21{f21, nullptr, evaluate_f21, shift_objective};
+
+    template <typename T>
+    class Gallagher : public BBOProblem<T>
+    {
     public:
         Gallagher(const int problem_id, const int instance, const int n_variables, const std::string &name,
-                  const int number_of_peaks, const double b = 10., const double c = 5.0,
-                  double max_condition = sqrt(1000.)) :
-            BBOProblem<T>(problem_id, instance, n_variables, name),
-            x_transformation_(n_variables, std::vector<double>(number_of_peaks)),
-            peaks_(Peak::get_peaks(number_of_peaks, n_variables, this->transformation_state_.seed, max_condition)),
-            factor_(-0.5 / static_cast<double>(n_variables))
+                  const Stages &stages, const Initializer initialize) :
+            BBOProblem<T>(problem_id, instance, n_variables, name, stages, initialize)
         {
-            const auto random_numbers = common::random::bbob2009::uniform(
-                this->meta_data_.n_variables * number_of_peaks, this->transformation_state_.seed);
-
-
-            for (auto i = 0; i < this->meta_data_.n_variables; ++i)
-            {
-                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
-                for (auto j = 0; j < number_of_peaks; ++j)
-                {
-                    for (auto k = 0; k < this->meta_data_.n_variables; ++k)
-                        x_transformation_[i][j] += this->transformation_state_.second_rotation[i][k] * (
-                            b * random_numbers.at(j * this->meta_data_.n_variables + k) - c
-                        );
-                    if (j == 0)
-                        x_transformation_[i][j] *= 0.8;
-                }
-            }
         }
     };
 
@@ -150,7 +142,7 @@ namespace ioh::problem::bbob
     {
     public:
         Gallagher101(const int instance, const int n_variables):
-            Gallagher(21, instance, n_variables, "Gallagher101", 101, 10., 5.0)
+            Gallagher(21, instance, n_variables, "Gallagher101", stages_f21, initialize_f21)
         {
         }
     };
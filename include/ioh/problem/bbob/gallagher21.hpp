@@ -1,14 +1,24 @@
 #pragma once
 
-#include "bbob_problem.hpp"
+#include "gallagher101.hpp"
 
 namespace ioh::problem::bbob
 {
+    inline void initialize_f22(InstanceParams &params) { initialize_gallagher(params, 21, 9.8, 4.9, 1000.); }
+
+    //! Gallagher with 21 peaks, see f21
+    inline double f22(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return f21(x, n, params);
+    }
+
+    inline constexpr Stages stages_f22{f22, nullptr, evaluate_f21, shift_objective};
+
     class Gallagher21 final : public Gallagher<Gallagher21>
     {
     public:
         Gallagher21(const int instance, const int n_variables) :
-            Gallagher(22, instance, n_variables, "Gallagher21", 21, 9.8, 4.9, 1000.)
+            Gallagher(22, instance, n_variables, "Gallagher21", stages_f22, initialize_f22)
         {
         }
     };
@@ -4,48 +4,50 @@
 
 namespace ioh::problem::bbob
 {
-    class GriewankRosenBrock final : public BBOProblem<GriewankRosenBrock>
+    //! Scales the second rotation by max(1, sqrt(n) / 8)
+    inline void initialize_f19(InstanceParams &params)
     {
-        std::vector<double> x_shift_;
-    protected:
-        double evaluate(const std::vector<double> &x) override
+        auto &rotation = params.state.second_rotation;
+        const auto n_variables = params.n_variables;
+        const auto factor = std::max(1., sqrt(n_variables) / 8.);
+
+        for (auto i = 0; i < n_variables; ++i)
         {
-            auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables - 1; ++i) {
-                const auto c1 = 100.0 * pow(pow(x.at(i), 2.0) - x.at(i + 1), 2.0);
-                const auto c2 = pow(1.0 - x.at(i), 2.0);
-                const auto z =  c1 + c2;
-                result += z / 4000. - cos(z);
+            auto sum = 0.0;
+            for (auto j = 0; j < n_variables; ++j)
+            {
+                rotation[i][j] *= factor;
+                sum += rotation[j][i];
             }
-            return 10. + 10. * result / static_cast<double>(meta_data_.n_variables - 1);
-        }
-    
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            affine(x, transformation_state_.second_rotation,
-                                                    transformation_state_.transformation_base);
-            subtract(x, x_shift_);
-            return x;
+            params.objective.x[i] = sum / (2. * factor);
         }
-    
+    }
+
+    inline void transform_f19(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.second_rotation, params.state.transformation_base.data(), x, z.data(), z.size(),
+                  [](size_t, const double zi) { return zi + 0.5; });
+    }
+
+    inline double evaluate_f19(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::griewank_rosenbrock(z, n);
+    }
+
+    //! GriewankRosenbrock, evaluated at R * x + 0.5
+    inline double f19(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f19, evaluate_f19, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f19{f19, transform_f19, evaluate_f19, shift_objective};
+
+    class GriewankRosenBrock final : public BBOProblem<GriewankRosenBrock>
+    {
     public:
         GriewankRosenBrock(const int instance, const int n_variables) :
-            BBOProblem(19, instance, n_variables, "GriewankRosenBrock"),
-            x_shift_(n_variables, -0.5)
+            BBOProblem(19, instance, n_variables, "GriewankRosenBrock", stages_f19, initialize_f19)
         {
-            const auto factor = std::max(1., sqrt(n_variables) / 8.);
-            
-            for (auto i = 0; i < n_variables; ++i)
-            {
-                auto sum = 0.0;
-                for (auto j = 0; j < n_variables; ++j)
-                {
-                    transformation_state_.second_rotation[i][j] *= factor;
-                    sum += transformation_state_.second_rotation.at(j).at(i);
-                }
-                objective_.x[i] = sum / (2. * factor);
-            }
         }
     };
 }
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <random>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include "ioh/common/file.hpp"
+#include "ioh/common/matrix.hpp"
+
+namespace ioh::problem::bbob
+{
+    /**
+     * \brief Opt-in, file-backed cache of the rotation matrices of BBOB instances, which are the O(n^3) part of
+     * constructing a BBOB problem. When enabled, the first process which creates a given
+     * (problem_id, instance, n_variables) writes the matrices to a file in the cache directory, and every later
+     * process maps the file into memory, and uses the matrices as views into it instead of recomputing them. A
+     * warm start then only costs the page-in of the rows which are used. On Windows the file is read instead.
+     *
+     * A cache file consists of a Header, padded to data_offset bytes, followed by the matrices in the row-major
+     * layout of common::Matrix, with the rows padded to a multiple of 64 bytes, in the native byte order. Files
+     * with another magic number, version, key or size are ignored and rewritten.
+     */
+    class InstanceCache
+    {
+    public:
+        //! The version of the binary layout, which is increased whenever the layout changes
+        static constexpr std::uint32_t version = 2;
+
+        //! The offset of the first matrix in a cache file, which keeps the rows of the mapped matrices aligned
+        static constexpr std::size_t data_offset = common::Matrix<double>::alignment;
+
+        //! The first four bytes of every cache file, "IOHB"
+        static constexpr std::uint32_t magic = 0x42484f49;
+
+        //! The header of a cache file
+        struct Header
+        {
+            std::uint32_t magic = InstanceCache::magic;
+            std::uint32_t version = InstanceCache::version;
+            std::int32_t problem_id = 0;
+            std::int32_t instance = 0;
+            std::int32_t n_variables = 0;
+            std::int32_t element_size = sizeof(double);
+            std::int64_t seed = 0;
+            double condition = 0;
+
+            bool operator==(const Header &other) const
+            {
+                return magic == other.magic && version == other.version && problem_id == other.problem_id &&
+                    instance == other.instance && n_variables == other.n_variables &&
+                    element_size == other.element_size && seed == other.seed && condition == other.condition;
+            }
+        };
+
+    private:
+        static std::mutex &mutex()
+        {
+            static std::mutex mutex;
+            return mutex;
+        }
+
+        static fs::path &directory_()
+        {
+            static fs::path directory;
+            return directory;
+        }
+
+        /**
+         * \brief Maps a cache file into memory, read-only
+         * \param file the cache file
+         * \param size the expected size of the file in bytes
+         * \return the memory of the file, which is released with the last reference to it, or nullptr when the
+         * file is missing or has another size
+         */
+        static std::shared_ptr<const void> map(const fs::path &file, const std::size_t size)
+        {
+            std::error_code ec;
+            if (fs::file_size(file, ec) != size || ec)
+                return nullptr;
+#ifdef _WIN32
+            using Buffer = std::vector<double, common::AlignedAllocator<double, data_offset>>;
+            auto buffer = std::make_shared<Buffer>(size / sizeof(double));
+            std::ifstream stream(file, std::ios::binary);
+            if (!stream.read(reinterpret_cast<char *>(buffer->data()), static_cast<std::streamsize>(size)))
+                return nullptr;
+            return std::shared_ptr<const void>(buffer, buffer->data());
+#else
+            const auto descriptor = ::open(file.c_str(), O_RDONLY);
+            if (descriptor < 0)
+                return nullptr;
+            auto *address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0);
+            ::close(descriptor);
+            if (address == MAP_FAILED)
+                return nullptr;
+            return std::shared_ptr<const void>(address, [size](const void *ptr) {
+                ::munmap(const_cast<void *>(ptr), size);
+            });
+#endif
+        }
+
+        //! The size of a cache file with a given number of matrices
+        static std::size_t file_size(const Header &header, const std::size_t n_matrices)
+        {
+            const auto n = static_cast<std::size_t>(header.n_variables);
+            return data_offset + n_matrices * n * common::Matrix<double>::padded(n) * sizeof(double);
+        }
+
+    public:
+        /**
+         * \brief Enables the cache
+         * \param directory the directory in which the cache files are stored, which is created if needed
+         */
+        static void enable(const fs::path &directory)
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            create_directories(directory);
+            directory_() = directory;
+        }
+
+        //! Disables the cache, the files which were already written are kept
+        static void disable()
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            directory_().clear();
+        }
+
+        //! The directory of the cache, which is empty when the cache is disabled
+        [[nodiscard]]
+        static fs::path directory()
+        {
+            std::lock_guard<std::mutex> lock(mutex());
+            return directory_();
+        }
+
+        /**
+         * \brief The file in which an instance is cached
+         * \param header the header of the instance
+         * \return an empty path when the cache is disabled
+         */
+        [[nodiscard]]
+        static fs::path path(const Header &header)
+        {
+            const auto root = directory();
+            if (root.empty())
+                return {};
+            return root / fmt::format("bbob_v{}_f{}_i{}_d{}.bin", version, header.problem_id, header.instance,
+                                      header.n_variables);
+        }
+
+        /**
+         * \brief Loads the matrices of an instance from the cache. The matrices become views into the mapped
+         * file, which stays mapped until the last of them, or of their copies, is destroyed or written to.
+         * \param header the header of the instance, which must match the header of the file
+         * \param matrices receive the matrices, of the shape n_variables x n_variables
+         * \return false when the cache is disabled, or the file is missing or does not match
+         */
+        static bool load(const Header &header, std::initializer_list<common::Matrix<double> *> matrices)
+        {
+            const auto file = path(header);
+            if (file.empty())
+                return false;
+
+            const auto mapping = map(file, file_size(header, matrices.size()));
+            if (mapping == nullptr)
+                return false;
+
+            const auto *bytes = static_cast<const char *>(mapping.get());
+            Header stored;
+            std::memcpy(&stored, bytes, sizeof(Header));
+            if (!(stored == header))
+                return false;
+
+            const auto n = static_cast<size_t>(header.n_variables);
+            const auto *elements = reinterpret_cast<const double *>(bytes + data_offset);
+            for (auto *matrix : matrices)
+            {
+                *matrix = common::Matrix<double>::view(mapping, elements, n, n);
+                elements += n * matrix->stride();
+            }
+            return true;
+        }
+
+        /**
+         * \brief Writes the matrices of an instance to the cache. The file is written under a temporary name and
+         * then renamed, so that concurrent processes never read a partially written file.
+         * \param header the header of the instance
+         * \param matrices the matrices to write, in the order in which load reads them
+         */
+        static void store(const Header &header, std::initializer_list<const common::Matrix<double> *> matrices)
+        {
+            const auto file = path(header);
+            if (file.empty())
+                return;
+
+            auto temporary = file;
+            temporary += fmt::format(".{}.tmp", std::random_device{}());
+            {
+                std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+                char padded_header[data_offset] = {};
+                std::memcpy(padded_header, &header, sizeof(Header));
+                stream.write(padded_header, data_offset);
+
+                const auto n = static_cast<size_t>(header.n_variables);
+                for (const auto *matrix : matrices)
+                    stream.write(reinterpret_cast<const char *>(matrix->data()),
+                                 static_cast<std::streamsize>(n * matrix->stride() * sizeof(double)));
+                if (!stream)
+                {
+                    stream.close();
+                    std::error_code ec;
+                    fs::remove(temporary, ec);
+                    return;
+                }
+            }
+            std::error_code ec;
+            fs::rename(temporary, file, ec);
+            if (ec)
+                fs::remove(temporary, ec);
+        }
+    };
+}
@@ -4,54 +4,39 @@
 
 namespace ioh::problem::bbob
 {
-    class Katsuura final : public BBOProblem<Katsuura>
-
+    inline void initialize_f23(InstanceParams &params)
     {
-        double exponent_;
-        double factor_;
-
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result = 1.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-            {
-                double z = 0;
-                for (size_t j = 1; j < 33; ++j)
-                    z += fabs(transformation_state_.exponents.at(j) * x.at(i)
-                            - floor(transformation_state_.exponents.at(j) * x.at(i) + 0.5))
-                        / transformation_state_.exponents.at(j);
+        const auto n = static_cast<double>(params.n_variables);
+        params.exponent = 10. / pow(n, 1.2);
+        params.factor = 10. / n / n;
+        params.penalty_factor = 1.0;
+        params.set_offset(params.state.second_transformation_matrix);
+    }
+
+    inline void transform_f23(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.second_transformation_matrix, params.offset.data(), x, z.data(), z.size());
+    }
 
-                result *= pow(1.0 + (static_cast<double>(i) + 1) * z, exponent_);
-            }
-            result = factor_ * (-1. + result);
-            return result;
-        }
+    inline double evaluate_f23(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::katsuura(z, n, params.exponent, params.factor);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    //! Katsuura, evaluated at M * (x - xopt) and penalized outside of the domain
+    inline double f23(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f23, evaluate_f23, shift_and_penalize>(x, n, params);
+    }
 
-        double transform_objectives(const double y) override
-        {
-            using namespace transformation::objective;
-            static const auto penalty_factor = 1.0;
-            return penalize(state_.current.x, constraint_, penalty_factor, shift(y, objective_.y));
-        }
+    inline constexpr Stages stages_f23{f23, transform_f23, evaluate_f23, shift_and_penalize};
 
+    class Katsuura final : public BBOProblem<Katsuura>
+    {
     public:
         Katsuura(const int instance, const int n_variables) :
-            BBOProblem(23, instance, n_variables, "Katsuura", sqrt(100.0)),
-            exponent_(10. / pow(static_cast<double>(meta_data_.n_variables), 1.2)),
-            factor_(10. / static_cast<double>(meta_data_.n_variables) / static_cast<double>(meta_data_.n_variables))
+            BBOProblem(23, instance, n_variables, "Katsuura", stages_f23, initialize_f23, sqrt(100.0))
         {
-            transformation_state_.exponents.resize(33);
-            for (auto i = 1; i < 33; ++i)
-                transformation_state_.exponents[i] = pow(2., static_cast<double>(i));
         }
     };
 }
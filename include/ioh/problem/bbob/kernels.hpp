@@ -0,0 +1,528 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ioh/common/config.hpp"
+#include "ioh/common/matrix.hpp"
+#include "ioh/common/simd.hpp"
+
+//! The raw objective functions of the BBOB problems, which are evaluated on the transformed variables
+namespace ioh::problem::bbob::kernels
+{
+    inline double sphere(const double *x, const size_t n)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            result += x[i] * x[i];
+        return result;
+    }
+
+    /**
+     * \param conditions the weight of each variable, of which the first is not used
+     */
+    inline double ellipsoid(const double *x, const size_t n, const double *conditions)
+    {
+        auto result = x[0] * x[0];
+        for (size_t i = 1; i < n; ++i)
+            result += conditions[i] * x[i] * x[i];
+        return result;
+    }
+
+    inline double rastrigin(const double *x, const size_t n)
+    {
+        auto sum1 = 0.0, sum2 = 0.0;
+
+        for (size_t i = 0; i < n; ++i)
+        {
+            sum1 += cos(2.0 * IOH_PI * x[i]);
+            sum2 += x[i] * x[i];
+        }
+        if (std::isinf(sum2))
+            return sum2;
+
+        return 10.0 * (static_cast<double>(n) - sum1) + sum2;
+    }
+
+    /**
+     * \param conditions the signed slope of each variable
+     * \param xopt the optimum, which lies on the boundary
+     */
+    inline double linear_slope(const double *x, const size_t n, const double *conditions, const double *xopt)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            result += 5.0 * fabs(conditions[i]) - conditions[i] * (x[i] * xopt[i] < 25.0 ? x[i] : xopt[i]);
+        return result;
+    }
+
+    /**
+     * \param xopt the optimum, of which the signs determine the attractive sector
+     */
+    inline double attractive_sector(const double *x, const size_t n, const double *xopt)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            result += x[i] * x[i] * (1. + 9999.0 * (xopt[i] * x[i] > 0.0));
+        return result;
+    }
+
+    //! Rounds a variable of the step ellipsoid to its plateau
+    inline double step_ellipsoid_round(const double z)
+    {
+        static const auto alpha = 10.0;
+        return fabs(z) > .5 ? floor(z + .5) : floor(alpha * z + .5) / alpha;
+    }
+
+    /**
+     * \param projection the rotation of the rounded variables
+     * \param weights the weight of each squared projection
+     * \param x0 the first variable before rounding, which keeps the function from being flat
+     */
+    inline double step_ellipsoid(const double *projection, const size_t n, const double *weights, const double x0)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            result += weights[i] * projection[i] * projection[i];
+        return 0.1 * (fabs(x0) * 1.0e-4 > result ? fabs(x0) * 1.0e-4 : result);
+    }
+
+    inline double rosenbrock(const double *x, const size_t n)
+    {
+        auto sum1 = 0.0, sum2 = 0.0;
+
+        for (size_t i = 0; i < n - 1; ++i)
+        {
+            sum1 += pow(x[i] * x[i] - x[i + 1], 2.0);
+            sum2 += pow(x[i] - 1.0, 2.0);
+        }
+        return 100.0 * sum1 + sum2;
+    }
+
+    inline double discus(const double *x, const size_t n)
+    {
+        static const auto condition = 1.0e6;
+        auto result = condition * x[0] * x[0];
+        for (size_t i = 1; i < n; ++i)
+            result += x[i] * x[i];
+        return result;
+    }
+
+    inline double bent_cigar(const double *x, const size_t n)
+    {
+        static const auto condition = 1.0e6;
+        auto result = x[0] * x[0];
+        for (size_t i = 1; i < n; ++i)
+            result += condition * x[i] * x[i];
+        return result;
+    }
+
+    /**
+     * \param n_linear_dimensions the number of leading variables which form the smooth part of the ridge
+     */
+    inline double sharp_ridge(const double *x, const size_t n, const int n_linear_dimensions)
+    {
+        static const auto alpha = 100.0;
+        const auto n_linear = static_cast<size_t>(n_linear_dimensions);
+
+        auto result = 0.0;
+        for (auto i = n_linear; i < n; ++i)
+            result += x[i] * x[i];
+
+        result = alpha * sqrt(result / n_linear_dimensions);
+        for (size_t i = 0; i < n_linear; ++i)
+            result += x[i] * x[i] / n_linear_dimensions;
+
+        return result;
+    }
+
+    /**
+     * \param exponents the exponent of each variable
+     */
+    inline double different_powers(const double *x, const size_t n, const double *exponents)
+    {
+        auto sum = 0.0;
+        for (size_t i = 0; i < n; ++i)
+            sum += pow(fabs(x[i]), exponents[i]);
+        return sqrt(sum);
+    }
+
+    namespace weierstrass_constants
+    {
+        //! The number of harmonics of the Weierstrass function
+        constexpr size_t n_harmonics = 12;
+
+        constexpr std::array<double, n_harmonics> make_amplitudes()
+        {
+            std::array<double, n_harmonics> amplitudes{};
+            auto amplitude = 1.0;
+            for (auto &a : amplitudes)
+            {
+                a = amplitude;
+                amplitude *= 0.5;
+            }
+            return amplitudes;
+        }
+
+        constexpr std::array<double, n_harmonics> make_frequencies()
+        {
+            std::array<double, n_harmonics> frequencies{};
+            auto frequency = 1.0;
+            for (auto &b : frequencies)
+            {
+                b = frequency;
+                frequency *= 3.0;
+            }
+            return frequencies;
+        }
+
+        constexpr double make_f0()
+        {
+            auto f0 = 0.0;
+            for (const auto a : make_amplitudes())
+                f0 -= a;
+            return f0;
+        }
+
+        //! The amplitudes a_k = 0.5^k of the harmonics
+        constexpr auto amplitudes = make_amplitudes();
+
+        //! The frequencies b_k = 3^k of the harmonics
+        constexpr auto frequencies = make_frequencies();
+
+        //! The sum of the harmonics at zero, sum_k a_k * cos(pi * b_k), which is -sum_k a_k since every b_k is odd
+        constexpr auto f0 = make_f0();
+    }
+
+    /**
+     * \brief Evaluates the harmonics cos(2 pi b_k (x_i + 0.5)) without a libm call per harmonic. With
+     * w = exp(2 pi i (x_i + 0.5)), harmonic k is the real part of w^(3^k), and each power is the cube of the
+     * previous one, (c + i s)^3 = c (c^2 - 3 s^2) + i s (3 c^2 - s^2). Only sin and cos of the base angle are
+     * computed with libm.
+     *
+     * Error bound: cubing a point of the unit circle triples its absolute error and adds a few ulp of rounding,
+     * so the error of harmonic k is below 4 * 3^k * eps. The amplitudes halve with k, and the weighted sum of the
+     * harmonics of a variable is within sum_k 0.5^k * 4 * 3^k * eps < 1100 eps (2.5e-13) of the exact value for the
+     * rounded base angle. Evaluating cos(2 pi b_k (x_i + 0.5)) directly amplifies the rounding of the angle by the
+     * same 3^k, so both evaluations agree to within this bound plus that rounding.
+     */
+    inline double weierstrass(const double *x, const size_t n)
+    {
+        using namespace weierstrass_constants;
+        constexpr size_t chunk = 64;
+
+        double c[chunk], s[chunk];
+        auto result = 0.0;
+        for (size_t i = 0; i < n; i += chunk)
+        {
+            const auto size = std::min(chunk, n - i);
+            for (size_t k = 0; k < size; ++k)
+            {
+                const auto angle = 2 * IOH_PI * (x[i + k] + 0.5);
+                c[k] = cos(angle);
+                s[k] = sin(angle);
+            }
+
+            auto sum = 0.0;
+            for (size_t h = 0; h < n_harmonics; ++h)
+            {
+                auto harmonic = 0.0;
+                for (size_t k = 0; k < size; ++k)
+                {
+                    harmonic += c[k];
+                    const auto c2 = c[k] * c[k], s2 = s[k] * s[k];
+                    c[k] = c[k] * (c2 - 3.0 * s2);
+                    s[k] = s[k] * (3.0 * c2 - s2);
+                }
+                sum += amplitudes[h] * harmonic;
+            }
+            result += sum;
+        }
+
+        result = result / static_cast<double>(n) - f0;
+        result = 10.0 * pow(result, 3.0);
+        return result;
+    }
+
+    inline double schaffers(const double *x, const size_t n)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n - 1; ++i)
+        {
+            const auto z = pow(x[i], 2.0) + pow(x[i + 1], 2.0);
+            result += pow(z, 0.25) * (1.0 + pow(sin(50.0 * pow(z, 0.1)), 2.0));
+        }
+        return pow(result / (static_cast<double>(n) - 1.0), 2.0);
+    }
+
+    inline double griewank_rosenbrock(const double *x, const size_t n)
+    {
+        auto result = 0.0;
+        for (size_t i = 0; i < n - 1; ++i)
+        {
+            const auto c1 = 100.0 * pow(pow(x[i], 2.0) - x[i + 1], 2.0);
+            const auto c2 = pow(1.0 - x[i], 2.0);
+            const auto z = c1 + c2;
+            result += z / 4000. - cos(z);
+        }
+        return 10. + 10. * result / static_cast<double>(n - 1);
+    }
+
+    inline double schwefel(const double *x, const size_t n)
+    {
+        static const auto correction = 418.9828872724339;
+        auto result = 0.0;
+
+        auto penalty = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto out_of_bounds = fabs(x[i]) - 500.0;
+            if (out_of_bounds > 0.0)
+                penalty += out_of_bounds * out_of_bounds;
+
+            result += x[i] * sin(sqrt(fabs(x[i])));
+        }
+        return 0.01 * (penalty + correction - result / static_cast<double>(n));
+    }
+
+    /**
+     * \brief The peaks of a Gallagher function, as contiguous peak-major arrays: row i of centers and scales holds
+     * the rotated location and the per-variable scales of peak i
+     */
+    struct GallagherPeaks
+    {
+        common::Matrix<double> centers;
+        common::Matrix<double> scales;
+        std::vector<double> values;
+
+        //! log(values), by which the peaks are compared without evaluating exp for each of them
+        std::vector<double> log_values;
+
+        GallagherPeaks() = default;
+
+        GallagherPeaks(const size_t n_peaks, const size_t n_variables) :
+            centers(n_peaks, n_variables), scales(n_peaks, n_variables), values(n_peaks), log_values(n_peaks)
+        {
+        }
+
+        [[nodiscard]] size_t size() const { return values.size(); }
+    };
+
+    /**
+     * \brief Only the highest peak, value_i * exp(factor * distance_i), determines the function value. Since exp
+     * is monotonic, the peaks are compared by log(value_i) + factor * distance_i, and exp is evaluated once.
+     * \param z the rotated variables
+     * \param peaks the location and shape of the peaks
+     * \param factor the scaling of the exponents, -0.5 / n
+     * \return the function value without the penalty on the boundary
+     */
+    inline double gallagher(const double *z, const size_t n, const GallagherPeaks &peaks, const double factor)
+    {
+        static const auto a = 0.1;
+        constexpr size_t chunk = 8;
+
+        double distances[chunk];
+        auto best = -std::numeric_limits<double>::infinity();
+        auto best_exponent = -std::numeric_limits<double>::infinity();
+        size_t winner = 0;
+        for (size_t i = 0; i < peaks.size(); i += chunk)
+        {
+            const auto rows = std::min(chunk, peaks.size() - i);
+            common::simd::weighted_distances(peaks.centers[i], peaks.scales[i], peaks.centers.stride(), z, distances,
+                                             rows, n);
+            for (size_t k = 0; k < rows; ++k)
+            {
+                const auto exponent = factor * distances[k];
+                const auto argument = peaks.log_values[i + k] + exponent;
+                if (argument > best)
+                {
+                    best = argument;
+                    best_exponent = exponent;
+                    winner = i + k;
+                }
+            }
+        }
+        auto result = 10. - peaks.values[winner] * exp(best_exponent);
+
+        if (result > 0)
+        {
+            result = log(result) / a;
+            result = pow(exp(result + 0.49 * (sin(result) + sin(0.79 * result))), a);
+        }
+        else if (result < 0)
+        {
+            result = log(-result) / a;
+            result = -pow(exp(result + 0.49 * (sin(0.55 * result) + sin(0.31 * result))), a);
+        }
+        return result * result;
+    }
+
+    namespace detail
+    {
+        /**
+         * \brief Computes the sums sum_j |2^j x_i - round(2^j x_i)| / 2^j, for j = 1..32, of the Katsuura function.
+         * 2^j x_i and 1 / 2^j are obtained by repeated doubling and halving, which only change the exponent and are
+         * exact, so every kernel gives the same result.
+         */
+        inline void katsuura_sums_scalar(const double *x, double *out, const size_t n)
+        {
+            for (size_t i = 0; i < n; ++i)
+            {
+                auto v = x[i], scale = 1.0, z = 0.0;
+                for (auto j = 1; j < 33; ++j)
+                {
+                    v *= 2.0;
+                    scale *= 0.5;
+                    z += fabs(v - floor(v + 0.5)) * scale;
+                }
+                out[i] = z;
+            }
+        }
+
+#if defined(IOH_SIMD_X86)
+        IOH_SIMD_TARGET("avx2")
+        inline void katsuura_sums_avx2(const double *x, double *out, const size_t n)
+        {
+            const auto half = _mm256_set1_pd(0.5), two = _mm256_set1_pd(2.0), sign = _mm256_set1_pd(-0.0);
+            size_t i = 0;
+            for (; i + 4 <= n; i += 4)
+            {
+                auto v = _mm256_loadu_pd(x + i), scale = _mm256_set1_pd(1.0), z = _mm256_setzero_pd();
+                for (auto j = 1; j < 33; ++j)
+                {
+                    v = _mm256_mul_pd(v, two);
+                    scale = _mm256_mul_pd(scale, half);
+                    const auto distance = _mm256_sub_pd(v, _mm256_floor_pd(_mm256_add_pd(v, half)));
+                    z = _mm256_add_pd(z, _mm256_mul_pd(_mm256_andnot_pd(sign, distance), scale));
+                }
+                _mm256_storeu_pd(out + i, z);
+            }
+            katsuura_sums_scalar(x + i, out + i, n - i);
+        }
+
+#if !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+        IOH_SIMD_TARGET("avx512f")
+        inline void katsuura_sums_avx512(const double *x, double *out, const size_t n)
+        {
+            const auto half = _mm512_set1_pd(0.5), two = _mm512_set1_pd(2.0);
+            size_t i = 0;
+            for (; i + 8 <= n; i += 8)
+            {
+                auto v = _mm512_loadu_pd(x + i), scale = _mm512_set1_pd(1.0), z = _mm512_setzero_pd();
+                for (auto j = 1; j < 33; ++j)
+                {
+                    v = _mm512_mul_pd(v, two);
+                    scale = _mm512_mul_pd(scale, half);
+                    const auto rounded = _mm512_roundscale_pd(_mm512_add_pd(v, half),
+                                                              _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+                    z = _mm512_add_pd(z, _mm512_mul_pd(_mm512_abs_pd(_mm512_sub_pd(v, rounded)), scale));
+                }
+                _mm512_storeu_pd(out + i, z);
+            }
+            katsuura_sums_scalar(x + i, out + i, n - i);
+        }
+#if !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+        //! Dispatches to the widest kernel, SSE2 has no floor instruction and uses the scalar kernel
+        inline void katsuura_sums(const double *x, double *out, const size_t n)
+        {
+            switch (common::simd::instruction_set())
+            {
+#if defined(IOH_SIMD_X86)
+            case common::simd::InstructionSet::AVX512:
+                katsuura_sums_avx512(x, out, n);
+                break;
+            case common::simd::InstructionSet::AVX2:
+                katsuura_sums_avx2(x, out, n);
+                break;
+#endif
+            default:
+                katsuura_sums_scalar(x, out, n);
+            }
+        }
+    }
+
+    /**
+     * \brief The product of the factors (1 + i * z_i)^exponent is computed as (prod_i (1 + i * z_i))^exponent, with
+     * a single pow. The product is kept below 2^512 by moving powers of two into a separate exponent, so that it
+     * cannot overflow in high dimensions.
+     * \param exponent the exponent of each factor of the product, 10 / n^1.2
+     * \param factor the scaling of the product, 10 / n^2
+     */
+    inline double katsuura(const double *x, const size_t n, const double exponent, const double factor)
+    {
+        constexpr size_t chunk = 64;
+        constexpr auto limit = 0x1p512;
+
+        double sums[chunk];
+        auto product = 1.0;
+        auto binary_exponent = 0;
+        for (size_t i = 0; i < n; i += chunk)
+        {
+            const auto size = std::min(chunk, n - i);
+            detail::katsuura_sums(x + i, sums, size);
+            for (size_t k = 0; k < size; ++k)
+            {
+                product *= 1.0 + static_cast<double>(i + k + 1) * sums[k];
+                if (product > limit)
+                {
+                    product = ldexp(product, -512);
+                    binary_exponent += 512;
+                }
+            }
+        }
+
+        auto result = pow(product, exponent);
+        if (binary_exponent != 0)
+            result *= exp2(static_cast<double>(binary_exponent) * exponent);
+        return factor * (-1. + result);
+    }
+
+    /**
+     * \brief The sum of the squared distances of the variables to [-5, 5], by which several functions are penalized
+     * outside of the domain
+     */
+    inline double boundary_penalty(const double *x, const size_t n)
+    {
+        auto penalty = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            const auto out_of_bounds = fabs(x[i]) - 5.0;
+            if (out_of_bounds > 0.0)
+                penalty += out_of_bounds * out_of_bounds;
+        }
+        return penalty;
+    }
+
+    /**
+     * \param x_hat the variables with the signs of the optimum folded in
+     * \param z the rotated and conditioned variables of the Rastrigin part
+     * \return the function value without the penalty on the boundary
+     */
+    inline double lunacek_bi_rastrigin(const double *x_hat, const double *z, const size_t n)
+    {
+        static const auto mu0 = 2.5;
+        static const auto d = 1.;
+        const auto double_n = static_cast<double>(n);
+        const auto s = 1. - 0.5 / (sqrt(double_n + 20) - 4.1);
+        const auto mu1 = -sqrt((mu0 * mu0 - d) / s);
+
+        auto sum1 = 0., sum2 = 0., sum3 = 0.;
+        for (size_t i = 0; i < n; ++i)
+        {
+            sum1 += (x_hat[i] - mu0) * (x_hat[i] - mu0);
+            sum2 += (x_hat[i] - mu1) * (x_hat[i] - mu1);
+            sum3 += cos(2 * IOH_PI * z[i]);
+        }
+        return std::min(sum1, d * double_n + s * sum2) + 10. * (double_n - sum3);
+    }
+}
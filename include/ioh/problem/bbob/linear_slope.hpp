@@ -4,36 +4,42 @@
 
 namespace ioh::problem::bbob
 {
-    class LinearSlope final : public BBOProblem<LinearSlope>
+    //! Moves the optimum to the corner of the domain, to which the slope points
+    inline void initialize_f5(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                result += 5.0 * fabs(transformation_state_.conditions.at(i)) - transformation_state_.conditions.at(i) *
-                (
-                    x.at(i) * objective_.x.at(i) < 25.0 ? x.at(i) : objective_.x.at(i)
-                );
-            return result;
-        }
+        static const auto base = sqrt(100.0);
+        for (auto i = 0; i < params.n_variables; ++i)
+            if (params.objective.x.at(i) < 0.0)
+            {
+                params.objective.x[i] = -5.0;
+                params.state.conditions[i] = -pow(base, params.state.exponents.at(i));
+            }
+            else
+            {
+                params.objective.x[i] = 5.0;
+                params.state.conditions[i] = pow(base, params.state.exponents.at(i));
+            }
+    }
+
+    inline double evaluate_f5(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return kernels::linear_slope(x, n, params.state.conditions.data(), params.objective.x.data());
+    }
 
+    //! LinearSlope, which is evaluated at x
+    inline double f5(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<nullptr, evaluate_f5, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f5{f5, nullptr, evaluate_f5, shift_objective};
+
+    class LinearSlope final : public BBOProblem<LinearSlope>
+    {
     public:
         LinearSlope(const int instance, const int n_variables) :
-            BBOProblem(5, instance, n_variables, "LinearSlope")
+            BBOProblem(5, instance, n_variables, "LinearSlope", stages_f5, initialize_f5)
         {
-            static const auto base = sqrt(100.0);
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                if (objective_.x.at(i) < 0.0)
-                {
-                    objective_.x[i] = constraint_.lb.at(0);
-                    transformation_state_.conditions[i] = -pow(base, transformation_state_.exponents.at(i));
-                }
-                else
-                {
-                    objective_.x[i] = constraint_.ub.at(0);
-                    transformation_state_.conditions[i] = pow(base, transformation_state_.exponents.at(i));
-                }
         }
     };
 }
@@ -4,61 +4,53 @@
 
 namespace ioh::problem::bbob
 {
-    class LunacekBiRastrigin final : public BBOProblem<LunacekBiRastrigin>
-
+    /**
+     * \brief Places the optimum at the signs of a normal sample. The Rastrigin part is evaluated at
+     * R1 * C * R2 * (x_hat - mu0), for the conditioning C = diag(sqrt(100)^(i / (n - 1))). The instance is created
+     * with condition sqrt(100), so the composed matrix R1 * C * R2 is the second transformation matrix, and the
+     * offset is set to -R1 * C * R2 * mu0.
+     */
+    inline void initialize_f24(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto mu0 = 2.5;
-            static const auto d = 1.;
-            const auto double_n = static_cast<double>(meta_data_.n_variables);
-            const auto s = 1. - 0.5 / (sqrt(double_n + 20) - 4.1);
-            const auto mu1 = -sqrt((mu0 * mu0 - d) / s);
-
-            auto sum1 = 0., sum2 = 0., sum3 = 0., penalty = 0.;
-
-            std::vector<double> transformation_base(meta_data_.n_variables);
-            std::vector<double> x_hat(meta_data_.n_variables);
-            std::vector<double> z(meta_data_.n_variables);
-
+        static const auto mu0 = 2.5;
+        const auto n = static_cast<size_t>(params.n_variables);
+        const auto &m = params.state.second_transformation_matrix;
+        const auto random_normal = common::random::bbob2009::normal(n, params.state.seed);
+        for (size_t i = 0; i < n; ++i)
+            params.objective.x[i] = random_normal.at(i) < 0.0 ? 0.5 * 2.5 * -1 : 0.5 * 2.5;
+
+        const std::vector<double> shift(n, mu0);
+        params.offset.resize(n);
+        common::simd::affine(m.data(), m.stride(), nullptr, shift.data(), params.offset.data(), n, n,
+                             [](size_t, const double value) { return -value; });
+    }
+
+    inline double evaluate_f24(const double *x, const size_t n, const InstanceParams &params)
+    {
+        auto &x_hat = buffer(n);
+        auto &z = buffer<1>(n);
 
-            /* x_hat */
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                x_hat[i] = objective_.x.at(i) > 0. ? 2. * x.at(i) : 2. * x.at(i) * -1;
-             
-            /* affine transformation */
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    transformation_base[i] += transformation_state_.conditions.at(i)
-                        * transformation_state_.second_rotation.at(i).at(j) * (x_hat.at(j) - mu0);
+        for (size_t i = 0; i < n; ++i)
+            x_hat[i] = params.objective.x[i] > 0. ? 2. * x[i] : 2. * x[i] * -1;
 
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-            {
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    z[i] += transformation_state_.first_rotation[i][j] * transformation_base[j];
+        transform(params.state.second_transformation_matrix, params.offset.data(), x_hat.data(), z.data(), n);
+        return kernels::lunacek_bi_rastrigin(x_hat.data(), z.data(), n) + 1e4 * kernels::boundary_penalty(x, n);
+    }
 
-                const auto out_of_bounds = fabs(x[i]) - 5.0;
-                if (out_of_bounds > 0.0)
-                    penalty += out_of_bounds * out_of_bounds;
+    //! LunacekBiRastrigin, of which the Rastrigin part is evaluated at R1 * C * R2 * (x_hat - mu0)
+    inline double f24(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<nullptr, evaluate_f24, shift_objective>(x, n, params);
+    }
 
-                sum1 += (x_hat[i] - mu0) * (x_hat[i] - mu0);
-                sum2 += (x_hat[i] - mu1) * (x_hat[i] - mu1);
-                sum3 += cos(2 * IOH_PI * z[i]);
-            }
-            return std::min(sum1, d * double_n + s * sum2) + 10. * (double_n - sum3) + 1e4 * penalty;
-        }
+    inline constexpr Stages stages_f24{f24, nullptr, evaluate_f24, shift_objective};
 
+    class LunacekBiRastrigin final : public BBOProblem<LunacekBiRastrigin>
+    {
     public:
         LunacekBiRastrigin(const int instance, const int n_variables) :
-            BBOProblem(24, instance, n_variables, "LunacekBiRastrigin")
+            BBOProblem(24, instance, n_variables, "LunacekBiRastrigin", stages_f24, initialize_f24, sqrt(100.))
         {
-            const auto random_normal = common::random::bbob2009::normal(n_variables, transformation_state_.seed);
-            for (auto i = 0; i < n_variables; ++i)
-            {
-                objective_.x[i] = random_normal.at(i) < 0.0 ? 0.5 * 2.5 * -1 : 0.5 * 2.5;
-                transformation_state_.conditions[i] = pow(sqrt(100.), transformation_state_.exponents.at(i));
-            }
         }
     };
 }
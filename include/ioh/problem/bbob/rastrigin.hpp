@@ -4,50 +4,41 @@
 
 namespace ioh::problem::bbob
 {
-    template<typename T>
-    class RastriginBase: public BBOProblem<T>
+    inline void initialize_f3(InstanceParams &params)
     {
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto sum1 = 0.0, sum2 = 0.0;
-
-            for (const auto xi : x)
-            {
-                sum1 += cos(2.0 * IOH_PI * xi);
-                sum2 += xi * xi;
-            }
-            if (std::isinf(sum2))
-                return sum2 ;
+        const auto n = static_cast<size_t>(params.n_variables);
+        params.coefficients = transformation::variables::asymmetric_coefficients(n, 0.2);
+        params.factors = transformation::variables::conditioning_factors(n, 10.0);
+    }
 
-            return 10.0 * (static_cast<double>(x.size()) - sum1) + sum2;
-        }
+    inline void transform_f3(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        using namespace transformation::variables;
+        subtract_optimum(x, z, params);
+        oscillate(z);
+        asymmetric(z, params.coefficients);
+        conditioning(z, params.factors);
+    }
+
+    inline double evaluate_f3(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::rastrigin(z, n);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, this->objective_.x);
-            oscillate(x);
-            asymmetric(x, 0.2);
-            conditioning(x, 10.0);
-            return x;
-        }
+    //! Rastrigin, evaluated at conditioning(asymmetric(oscillate(x - xopt)))
+    inline double f3(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f3, evaluate_f3, shift_objective>(x, n, params);
+    }
 
-    public:
-        RastriginBase(const int problem_id, const int instance, const int n_variables,  const std::string& name ) :
-            BBOProblem<T>(problem_id, instance, n_variables, name)
-        {
-        }
-    };
+    inline constexpr Stages stages_f3{f3, transform_f3, evaluate_f3, shift_objective};
 
-    class Rastrigin final: public RastriginBase<Rastrigin>
+    class Rastrigin final: public BBOProblem<Rastrigin>
     {
     public:
         Rastrigin(const int instance, const int n_variables) :
-            RastriginBase(3, instance, n_variables, "Rastrigin")
+            BBOProblem(3, instance, n_variables, "Rastrigin", stages_f3, initialize_f3)
         {
         }
     };
-
-
 }
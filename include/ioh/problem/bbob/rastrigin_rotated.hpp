@@ -4,23 +4,40 @@
 
 namespace ioh::problem::bbob
 {
-    class RastriginRotated final : public RastriginBase<RastriginRotated>
+    inline void initialize_f15(InstanceParams &params)
     {
-    protected:
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            oscillate(x);
-            asymmetric(x, 0.2);
-            affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+        params.set_offset(params.state.transformation_matrix);
+    }
+
+    inline void transform_f15(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        using namespace transformation::variables;
+        const auto n = z.size();
+        const Asymmetric asymmetry(0.2, n);
+        auto &y = buffer(n);
+        transform(params.state.transformation_matrix, params.offset.data(), x, y.data(), n,
+                  [&asymmetry](const size_t i, const double xi) { return asymmetry(i, Oscillate{}(i, xi)); });
+        transform(params.state.second_transformation_matrix, nullptr, y.data(), z.data(), n);
+    }
+
+    inline double evaluate_f15(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::rastrigin(z, n);
+    }
+
+    //! Rastrigin, evaluated at M2 * asymmetric(oscillate(M1 * (x - xopt)))
+    inline double f15(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f15, evaluate_f15, shift_objective>(x, n, params);
+    }
 
+    inline constexpr Stages stages_f15{f15, transform_f15, evaluate_f15, shift_objective};
+
+    class RastriginRotated final : public BBOProblem<RastriginRotated>
+    {
     public:
         RastriginRotated(const int instance, const int n_variables) :
-            RastriginBase(15, instance, n_variables, "RastriginRotated")
+            BBOProblem(15, instance, n_variables, "RastriginRotated", stages_f15, initialize_f15)
         {
         }
     };
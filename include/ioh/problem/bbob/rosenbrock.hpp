@@ -4,50 +4,45 @@
 
 namespace ioh::problem::bbob
 {
-    template<typename T>
-    class RosenbrockBase : public BBOProblem<T>
+    //! The scaling max(1, sqrt(n) / 8) of the Rosenbrock functions
+    inline double rosenbrock_factor(const int n_variables)
     {
-        double factor_;
-        std::vector<double> negative_one_;
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto sum1 = 0.0, sum2 = 0.0;
+        return std::max(1.0, std::sqrt(n_variables) / 8.0);
+    }
 
-            for (size_t i = 0; i < x.size() - 1; ++i) {
-                sum1 += pow(x.at(i) * x.at(i) - x.at(i + 1), 2.0);
-                sum2 += pow(x.at(i) - 1.0, 2.0);
-            }
-            return 100.0 * sum1 + sum2 ;
-        }
+    inline void initialize_f8(InstanceParams &params)
+    {
+        params.factor = rosenbrock_factor(params.n_variables);
+        for (auto &e : params.objective.x)
+            e *= 0.75;
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, this->objective_.x);
-            scale(x, factor_);
-            subtract(x, negative_one_);
-            return x;
-        }
+    inline void transform_f8(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        subtract_optimum(x, z, params);
+        for (auto &zi : z)
+            zi = zi * params.factor + 1.0;
+    }
 
-    public:
-        RosenbrockBase(const int problem_id, const int instance, const int n_variables, const std::string& name) :
-            BBOProblem<T>(problem_id, instance, n_variables, name),
-            factor_(std::max(1.0, std::sqrt(n_variables) / 8.0)), negative_one_(n_variables, -1)
-        {
-        }
-    };
+    inline double evaluate_f8(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::rosenbrock(z, n);
+    }
 
-    class Rosenbrock final: public RosenbrockBase<Rosenbrock>
+    //! Rosenbrock, evaluated at factor * (x - xopt) + 1
+    inline double f8(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f8, evaluate_f8, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f8{f8, transform_f8, evaluate_f8, shift_objective};
+
+    class Rosenbrock final: public BBOProblem<Rosenbrock>
     {
     public:
         Rosenbrock(const int instance, const int n_variables) :
-            RosenbrockBase(8, instance, n_variables, "Rosenbrock")
+            BBOProblem(8, instance, n_variables, "Rosenbrock", stages_f8, initialize_f8)
         {
-            for (auto& e : objective_.x)
-                e *= 0.75;
         }
     };
-
-  
 }
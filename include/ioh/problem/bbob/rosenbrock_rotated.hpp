@@ -5,33 +5,51 @@
 
 namespace ioh::problem::bbob
 {
-    class RosenbrockRotated final : public RosenbrockBase<RosenbrockRotated>
-
+    //! Scales the rotation, and moves the optimum to R^T * 1 / (2 * factor)
+    inline void initialize_f9(InstanceParams &params)
     {
-    protected:
-        std::vector<double> transform_variables(std::vector<double> x) override
+        auto &state = params.state;
+        const auto &rotation = state.second_rotation;
+        const auto n_variables = params.n_variables;
+        params.factor = rosenbrock_factor(n_variables);
+        for (auto i = 0; i < n_variables; ++i)
         {
-            transformation::variables::affine(x,
-                transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
+            auto sum = 0.0;
+            for (auto j = 0; j < n_variables; ++j)
+            {
+                state.second_transformation_matrix[i][j] = params.factor * rotation[i][j];
+                sum += rotation[j][i];
+            }
+            state.transformation_base[i] = 0.5;
+            params.objective.x[i] = sum / (2. * params.factor);
         }
+    }
+
+    inline void transform_f9(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.second_transformation_matrix, params.state.transformation_base.data(), x, z.data(),
+                  z.size());
+    }
+
+    inline double evaluate_f9(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::rosenbrock(z, n);
+    }
 
+    //! Rosenbrock, evaluated at factor * R * x + 0.5
+    inline double f9(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f9, evaluate_f9, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f9{f9, transform_f9, evaluate_f9, shift_objective};
+
+    class RosenbrockRotated final : public BBOProblem<RosenbrockRotated>
+    {
     public:
         RosenbrockRotated(const int instance, const int n_variables) :
-            RosenbrockBase(9, instance, n_variables, "RosenbrockRotated")
+            BBOProblem(9, instance, n_variables, "RosenbrockRotated", stages_f9, initialize_f9)
         {
-            const auto factor = std::max(1.0, std::sqrt(n_variables) / 8.0);
-            for (auto i = 0; i < n_variables; ++i)
-            {
-                auto sum = 0.0;
-                for (auto j = 0; j < n_variables; ++j)
-                {
-                    transformation_state_.second_transformation_matrix[i][j] = factor * transformation_state_.second_rotation.at(i).at(j);
-                    sum += transformation_state_.second_rotation.at(j).at(i);
-                }
-                transformation_state_.transformation_base[i] = 0.5;
-                objective_.x[i] = sum / (2. * factor);
-            }
         }
     };
 }
@@ -4,53 +4,57 @@
 
 namespace ioh::problem::bbob
 {
-    template <typename T>
-    class Schaffers : public BBOProblem<T>
+    /**
+     * \brief Replaces the second transformation matrix by R2 * diag(sqrt(condition)^(i / (n - 1)))
+     * \param params the parameters of the instance
+     * \param condition the condition of the Schaffers function
+     */
+    inline void initialize_schaffers(InstanceParams &params, const double condition)
     {
-    protected:
-        double condition_;
-
-        double evaluate(const std::vector<double> &x) override
+        auto &state = params.state;
+        const auto &rotation = state.second_rotation;
+        params.penalty_factor = 10.0;
+        params.set_offset(state.transformation_matrix);
+        for (auto i = 0; i < params.n_variables; ++i)
         {
-            auto result = 0.0;
-            for (auto i = 0; i < this->meta_data_.n_variables - 1; ++i)
-            {
-                const auto z = pow(x.at(i), 2.0) + pow(x.at(i + 1), 2.0);
-                result += pow(z, 0.25) * (1.0 + pow(sin(50.0 * pow(z, 0.1)), 2.0));
-            }
-            return pow(result / (static_cast<double>(this->meta_data_.n_variables) - 1.0), 2.0);
+            const auto scale = pow(sqrt(condition), state.exponents.at(i));
+            for (auto j = 0; j < params.n_variables; ++j)
+                state.second_transformation_matrix[i][j] = rotation[i][j] * scale;
         }
+    }
 
-        double transform_objectives(const double y) override
-        {
-            using namespace transformation::objective;
-            static const auto penalty_factor = 10.0;
-            return penalize<double>(this->state_.current.x, this->constraint_, penalty_factor,
-                                    shift(y, this->objective_.y));
-        }
+    inline void initialize_f17(InstanceParams &params) { initialize_schaffers(params, 10.0); }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, this->objective_.x);
-            affine(x, this->transformation_state_.transformation_matrix,
-                   this->transformation_state_.transformation_base);
-            asymmetric(x, 0.5);
-            affine(x, this->transformation_state_.second_transformation_matrix,
-                   this->transformation_state_.transformation_base);
-            return x;
-        }
+    inline void transform_f17(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        const auto n = z.size();
+        auto &y = buffer(n);
+        transform(params.state.transformation_matrix, params.offset.data(), x, y.data(), n,
+                  transformation::variables::Asymmetric(0.5, n));
+        transform(params.state.second_transformation_matrix, nullptr, y.data(), z.data(), n);
+    }
 
+    inline double evaluate_f17(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::schaffers(z, n);
+    }
+
+    //! Schaffers, evaluated at M2 * asymmetric(M1 * (x - xopt)) and penalized outside of the domain
+    inline double f17(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f17, evaluate_f17, shift_and_penalize>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f17{f17, transform_f17, evaluate_f17, shift_and_penalize};
+
+    template <typename T>
+    class Schaffers : public BBOProblem<T>
+    {
     public:
         Schaffers(const int problem_id, const int instance, const int n_variables, const std::string &name,
-                  const double condition) :
-            BBOProblem<T>(problem_id, instance, n_variables, name), condition_(condition)
+                  const Stages &stages, const Initializer initialize) :
+            BBOProblem<T>(problem_id, instance, n_variables, name, stages, initialize)
         {
-            for (auto i = 0; i < n_variables; ++i)
-                for (auto j = 0; j < n_variables; ++j)
-                    this->transformation_state_.second_transformation_matrix[i][j] =
-                        this->transformation_state_.second_rotation.at(i).at(j)
-                        * pow(sqrt(condition), this->transformation_state_.exponents.at(i));
         }
     };
 
@@ -58,7 +62,7 @@ namespace ioh::problem::bbob
     {
     public:
         Schaffers10(const int instance, const int n_variables) :
-            Schaffers(17, instance, n_variables, "Schaffers10", 10.0)
+            Schaffers(17, instance, n_variables, "Schaffers10", stages_f17, initialize_f17)
         {
         }
     };
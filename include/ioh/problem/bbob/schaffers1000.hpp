@@ -4,15 +4,22 @@
 
 namespace ioh::problem::bbob
 {
+    inline void initialize_f18(InstanceParams &params) { initialize_schaffers(params, 1000.0); }
+
+    //! Schaffers with condition 1000, see f17
+    inline double f18(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return f17(x, n, params);
+    }
+
+    inline constexpr Stages stages_f18{f18, transform_f17, evaluate_f17, shift_and_penalize};
+
     class Schaffers1000 final: public Schaffers<Schaffers1000>
     {
     public:
         Schaffers1000(const int instance, const int n_variables) :
-            Schaffers(18, instance, n_variables,  "Schaffers1000", 1000.0)
+            Schaffers(18, instance, n_variables,  "Schaffers1000", stages_f18, initialize_f18)
         {
         }
     };
-
-
-
 }
@@ -4,56 +4,51 @@
 
 namespace ioh::problem::bbob
 {
-    class Schwefel final : public BBOProblem<Schwefel>
-
+    //! The random signs as coefficients, and the conditioning factors
+    inline void initialize_f20(InstanceParams &params)
     {
-        std::vector<double> negative_offset_;
-        std::vector<double> positive_offset_;
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto correction = 418.9828872724339;
-            auto result = 0.0;
-
-            auto penalty = 0.0;
-            for (const auto &xi : x)
-            {
-                const auto out_of_bounds = fabs(xi) - 500.0;
-                if (out_of_bounds > 0.0)
-                    penalty += out_of_bounds * out_of_bounds;
+        const auto n = static_cast<size_t>(params.n_variables);
+        params.coefficients = transformation::variables::random_signs(n, params.state.seed);
+        params.factors = transformation::variables::conditioning_factors(n, 10.0);
+        for (size_t i = 0; i < n; ++i)
+            params.objective.x[i] = params.coefficients.at(i) * 0.5 * 4.2096874637;
+    }
+
+    inline void transform_f20(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        using namespace transformation::variables;
+        const auto n = z.size();
+        const auto &xopt = params.objective.x;
+        std::copy_n(x, n, z.begin());
+        random_sign_flip(z, params.coefficients);
+        scale(z, 2);
+        z_hat(z, xopt);
+        for (size_t i = 0; i < n; ++i)
+            z[i] -= 2 * fabs(xopt[i]);
+        conditioning(z, params.factors);
+        for (size_t i = 0; i < n; ++i)
+            z[i] = 100 * (z[i] + 2 * fabs(xopt[i]));
+    }
+
+    inline double evaluate_f20(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::schwefel(z, n);
+    }
 
-                result += xi * sin(sqrt(fabs(xi)));
-            }
-            result = 0.01 * (penalty + correction - result / static_cast<double>(meta_data_.n_variables));
-            return result;
-        }
+    //! Schwefel, evaluated at 100 * (conditioning(z_hat(2 * signs * x) - 2|xopt|) + 2|xopt|)
+    inline double f20(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f20, evaluate_f20, shift_objective>(x, n, params);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            transformation::variables::random_sign_flip(x, transformation_state_.seed);
-            transformation::variables::scale(x, 2);
-            transformation::variables::z_hat(x, objective_.x);
-            transformation::variables::subtract(x, positive_offset_);
-            transformation::variables::conditioning(x, 10.0);
-            transformation::variables::subtract(x, negative_offset_);
-            transformation::variables::scale(x, 100);
-            return x;
-        }
+    inline constexpr Stages stages_f20{f20, transform_f20, evaluate_f20, shift_objective};
 
+    class Schwefel final : public BBOProblem<Schwefel>
+    {
     public:
         Schwefel(const int instance, const int n_variables) :
-            BBOProblem(20, instance, n_variables, "Schwefel"),
-            negative_offset_(common::random::bbob2009::uniform(n_variables, transformation_state_.seed)),
-            positive_offset_(n_variables)
+            BBOProblem(20, instance, n_variables, "Schwefel", stages_f20, initialize_f20)
         {
-            for (auto i = 0; i < n_variables; ++i)
-                objective_.x[i] = (negative_offset_.at(i) < 0.5 ? -1 : 1) * 0.5 * 4.2096874637;
-
-            for (auto i = 0; i < n_variables; ++i)
-            {
-                negative_offset_[i] = -2 * fabs(objective_.x.at(i));
-                positive_offset_[i] = 2 * fabs(objective_.x.at(i));
-            }
         }
     };
 }
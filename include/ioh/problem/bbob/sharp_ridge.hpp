@@ -4,39 +4,36 @@
 
 namespace ioh::problem::bbob
 {
-    class SharpRidge final : public BBOProblem<SharpRidge>
-
+    inline void initialize_f13(InstanceParams &params)
     {
-        int n_linear_dimensions_;
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            static const auto alpha = 100.0;
+        params.n_linear_dimensions =
+            static_cast<int>(ceil(params.n_variables <= 40 ? 1 : params.n_variables / 40.0));
+        params.set_offset(params.state.second_transformation_matrix);
+    }
 
-            auto result = 0.0;
-            for (auto i = n_linear_dimensions_; i < meta_data_.n_variables; ++i)
-                result += x.at(i) * x.at(i);
+    inline void transform_f13(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        transform(params.state.second_transformation_matrix, params.offset.data(), x, z.data(), z.size());
+    }
 
-            result = alpha * sqrt(result / n_linear_dimensions_);
-            for (auto i = 0; i < n_linear_dimensions_; ++i)
-                result += x.at(i) * x.at(i) / n_linear_dimensions_;
+    inline double evaluate_f13(const double *z, const size_t n, const InstanceParams &params)
+    {
+        return kernels::sharp_ridge(z, n, params.n_linear_dimensions);
+    }
 
-            return result;
-        }
+    //! SharpRidge, evaluated at M * (x - xopt)
+    inline double f13(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f13, evaluate_f13, shift_objective>(x, n, params);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    inline constexpr Stages stages_f13{f13, transform_f13, evaluate_f13, shift_objective};
 
+    class SharpRidge final : public BBOProblem<SharpRidge>
+    {
     public:
         SharpRidge(const int instance, const int n_variables) :
-            BBOProblem(13, instance, n_variables, "SharpRidge"),
-        n_linear_dimensions_(static_cast<int>(
-            ceil(meta_data_.n_variables <= 40 ? 1 : meta_data_.n_variables / 40.0)))
+            BBOProblem(13, instance, n_variables, "SharpRidge", stages_f13, initialize_f13)
         {
         }
     };
@@ -3,26 +3,25 @@
 
 namespace ioh::problem::bbob
 {
-    class Sphere final: public BBOProblem<Sphere>
+    inline double evaluate_f1(const double *z, const size_t n, const InstanceParams &)
     {
-    protected:
-        double evaluate(const std::vector<double>& x) override
-        {
-            auto result = 0.0;
-            for (const auto xi : x)
-                result += xi * xi;
-            return result;
-        }
+        return kernels::sphere(z, n);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            transformation::variables::subtract(x, objective_.x);
-            return x;
-        }
+    //! Sphere, evaluated at x - xopt
+    inline double f1(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<subtract_optimum, evaluate_f1, shift_objective>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f1{f1, subtract_optimum, evaluate_f1, shift_objective};
+
+    class Sphere final: public BBOProblem<Sphere>
+    {
     public:
         Sphere(const int instance, const int n_variables) :
-            BBOProblem(1, instance, n_variables, "Sphere")
+            BBOProblem(1, instance, n_variables, "Sphere", stages_f1)
         {
         }
     };
-}
\ No newline at end of file
+}
@@ -4,69 +4,62 @@
 
 namespace ioh::problem::bbob
 {
-    class StepEllipsoid final : public BBOProblem<StepEllipsoid>
-
+    //! The conditions of the projection, and the weights 100^(i / (n - 1)) of the squared projections as factors
+    inline void initialize_f7(InstanceParams &params)
     {
-    protected:
-        double compute_projection(const std::vector<double>& x)
+        static const auto condition = 100.;
+        params.factors.resize(static_cast<size_t>(params.n_variables));
+        for (auto i = 0; i < params.n_variables; ++i)
         {
-            static const auto alpha = 10.0;
-            auto x0 = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-            {
-                transformation_state_.transformation_base[i] = 0.0;
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    transformation_state_.transformation_base[i] += transformation_state_.conditions.at(i)
-                    * transformation_state_.second_rotation.at(i).at(j)
-                    * (x.at(j) - objective_.x.at(j));
-
-                x0 = transformation_state_.transformation_base.at(0);
-
-                transformation_state_.transformation_base[i] = fabs(transformation_state_.transformation_base.at(i)) > .5
-                    ? floor(transformation_state_.transformation_base.at(i) + .5)
-                    : floor(alpha * transformation_state_.transformation_base.at(i) + .5) / alpha;
-            }
-            return x0;
+            params.state.conditions[i] = sqrt(pow(condition / 10., params.state.exponents.at(i)));
+            params.factors[i] = pow(100., params.state.exponents.at(i));
         }
+    }
 
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result = 0.0;
-            auto penalty = 0.0;
-            const auto x0 = compute_projection(x);
-
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-            {
-                const auto out_of_bounds = fabs(x.at(i)) - 5.0;
-                if (out_of_bounds > 0.0)
-                    penalty += out_of_bounds * out_of_bounds;
-
-                auto projection_sum = 0.0;
-                for (auto j = 0; j < meta_data_.n_variables; ++j)
-                    projection_sum += transformation_state_.first_rotation[i][j] * transformation_state_.transformation_base[j];
+    inline double evaluate_f7(const double *x, const size_t n, const InstanceParams &params)
+    {
+        const auto &state = params.state;
+        const auto &xopt = params.objective.x;
+        auto &z = buffer(n);
+        auto &projection = buffer<1>(n);
 
-                result += pow(100., transformation_state_.exponents.at(i))
-                    * projection_sum * projection_sum;
-            }
+        auto x0 = 0.0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            z[i] = 0.0;
+            for (size_t j = 0; j < n; ++j)
+                z[i] += state.conditions[i] * state.second_rotation[i][j] * (x[j] - xopt[j]);
 
-            result = 0.1 * (fabs(x0) * 1.0e-4 > result ? fabs(x0) * 1.0e-4 : result);
-            result += penalty + objective_.y;
-            return result;
+            x0 = z[0];
+            z[i] = kernels::step_ellipsoid_round(z[i]);
         }
 
-        double transform_objectives(const double y) override
+        for (size_t i = 0; i < n; ++i)
         {
-            return y;
+            auto projection_sum = 0.0;
+            for (size_t j = 0; j < n; ++j)
+                projection_sum += state.first_rotation[i][j] * z[j];
+            projection[i] = projection_sum;
         }
 
+        const auto result = kernels::step_ellipsoid(projection.data(), n, params.factors.data(), x0);
+        return result + (kernels::boundary_penalty(x, n) + params.objective.y);
+    }
+
+    //! StepEllipsoid, evaluated at the rotation of the rounded, conditioned rotation of x - xopt
+    inline double f7(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<nullptr, evaluate_f7, nullptr>(x, n, params);
+    }
+
+    inline constexpr Stages stages_f7{f7, nullptr, evaluate_f7, nullptr};
+
+    class StepEllipsoid final : public BBOProblem<StepEllipsoid>
+    {
     public:
         StepEllipsoid(const int instance, const int n_variables) :
-            BBOProblem(7, instance, n_variables, "StepEllipsoid")
+            BBOProblem(7, instance, n_variables, "StepEllipsoid", stages_f7, initialize_f7)
         {
-            static const auto condition = 100.;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                transformation_state_.conditions[i] = sqrt(pow(condition / 10.,
-                                                               transformation_state_.exponents.at(i)));
         }
     };
 }
@@ -4,53 +4,40 @@
 
 namespace ioh::problem::bbob
 {
-    class Weierstrass final : public BBOProblem<Weierstrass>
+    inline void initialize_f16(InstanceParams &params)
     {
-        double f0_;
-        double penalty_factor_;
-        std::vector<double> ak_;
-        std::vector<double> bk_;
+        params.penalty_factor = 10.0 / params.n_variables;
+        params.set_offset(params.state.transformation_matrix);
+    }
 
-    protected:
-        double evaluate(const std::vector<double> &x) override
-        {
-            auto result = 0.0;
-            for (auto i = 0; i < meta_data_.n_variables; ++i)
-                for (size_t j = 0; j < ak_.size(); ++j)
-                    result += cos(2 * IOH_PI * (x.at(i) + 0.5) * bk_.at(j)) * ak_.at(j);
+    inline void transform_f16(const double *x, std::vector<double> &z, const InstanceParams &params)
+    {
+        const auto n = z.size();
+        auto &y = buffer(n);
+        transform(params.state.transformation_matrix, params.offset.data(), x, y.data(), n,
+                  transformation::variables::Oscillate{});
+        transform(params.state.second_transformation_matrix, nullptr, y.data(), z.data(), n);
+    }
 
-            result = result / static_cast<double>(meta_data_.n_variables) - f0_;
-            result = 10.0 * pow(result, 3.0);
-            return result;
-        }
+    inline double evaluate_f16(const double *z, const size_t n, const InstanceParams &)
+    {
+        return kernels::weierstrass(z, n);
+    }
 
-        std::vector<double> transform_variables(std::vector<double> x) override
-        {
-            using namespace transformation::variables;
-            subtract(x, objective_.x);
-            affine(x, transformation_state_.transformation_matrix, transformation_state_.transformation_base);
-            oscillate(x);
-            affine(x, transformation_state_.second_transformation_matrix, transformation_state_.transformation_base);
-            return x;
-        }
+    //! Weierstrass, evaluated at M2 * oscillate(M1 * (x - xopt)) and penalized outside of the domain
+    inline double f16(const double *x, const size_t n, const InstanceParams &params)
+    {
+        return evaluate_stages<transform_f16, evaluate_f16, shift_and_penalize>(x, n, params);
+    }
 
-        double transform_objectives(const double y) override
-        {
-            using namespace transformation::objective;
-            return penalize(state_.current.x, constraint_, penalty_factor_, shift(y, objective_.y));
-        }
+    inline constexpr Stages stages_f16{f16, transform_f16, evaluate_f16, shift_and_penalize};
 
+    class Weierstrass final : public BBOProblem<Weierstrass>
+    {
     public:
         Weierstrass(const int instance, const int n_variables) :
-            BBOProblem(16, instance, n_variables, "Weierstrass", 1 / sqrt(100.0)),
-            f0_(0.0), penalty_factor_(10.0 / n_variables), ak_(12), bk_(12)
+            BBOProblem(16, instance, n_variables, "Weierstrass", stages_f16, initialize_f16, 1 / sqrt(100.0))
         {
-            for (size_t i = 0; i < ak_.size(); ++i)
-            {
-                ak_[i] = pow(0.5, static_cast<double>(i));
-                bk_[i] = pow(3., static_cast<double>(i));
-                f0_ += ak_.at(i) * cos(2 * IOH_PI * bk_.at(i) * 0.5);
-            }
         }
     };
 }
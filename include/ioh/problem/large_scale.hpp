@@ -0,0 +1,27 @@
+#pragma once
+
+#include "large_scale/large_scale_problem.hpp"
+#include "large_scale/sphere.hpp"
+#include "large_scale/ellipsoid.hpp"
+#include "large_scale/rastrigin.hpp"
+#include "large_scale/bueche_rastrigin.hpp"
+#include "large_scale/linear_slope.hpp"
+#include "large_scale/attractive_sector.hpp"
+#include "large_scale/step_ellipsoid.hpp"
+#include "large_scale/rosenbrock.hpp"
+#include "large_scale/rosenbrock_rotated.hpp"
+#include "large_scale/ellipsoid_rotated.hpp"
+#include "large_scale/discus.hpp"
+#include "large_scale/bent_cigar.hpp"
+#include "large_scale/sharp_ridge.hpp"
+#include "large_scale/different_powers.hpp"
+#include "large_scale/rastrigin_rotated.hpp"
+#include "large_scale/weierstrass.hpp"
+#include "large_scale/schaffers10.hpp"
+#include "large_scale/schaffers1000.hpp"
+#include "large_scale/griewank_rosenbrock.hpp"
+#include "large_scale/schwefel.hpp"
+#include "large_scale/gallagher101.hpp"
+#include "large_scale/gallagher21.hpp"
+#include "large_scale/katsuura.hpp"
+#include "large_scale/lunacek_bi_rastrigin.hpp"
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleAttractiveSector final : public LargeScaleBBOProblem<LargeScaleAttractiveSector>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::attractive_sector(x.data(), x.size(), objective_.x.data());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transformation::variables::subtract(x, objective_.x);
+            second_transformation(x);
+            return x;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            using namespace transformation::objective;
+            return shift(pow(oscillate(y), .9), objective_.y);
+        }
+
+    public:
+        LargeScaleAttractiveSector(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(6, instance, n_variables, "LargeScaleAttractiveSector")
+        {
+        }
+    };
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleBentCigar final : public LargeScaleBBOProblem<LargeScaleBentCigar>
+    {
+        std::vector<double> asymmetric_coefficients_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::bent_cigar(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            asymmetric(x, asymmetric_coefficients_);
+            rotate(x, transformation_state_->first_rotation);
+            return x;
+        }
+
+    public:
+        LargeScaleBentCigar(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(12, instance, n_variables, "LargeScaleBentCigar"),
+            asymmetric_coefficients_(transformation::variables::asymmetric_coefficients(n_variables, 0.5))
+        {
+        }
+    };
+}
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include "ioh/common/matrix.hpp"
+#include "ioh/common/random.hpp"
+#include "ioh/common/simd.hpp"
+
+namespace ioh::problem::large_scale
+{
+    /**
+     * \brief The orthogonal transformation P_l * B * P_r of the large-scale BBOB problems. B is block-diagonal with
+     * random orthogonal blocks, and P_l and P_r are random permutations which move each variable by at most one
+     * block size. Applying it costs O(n * b) time and storing it O(n * b) memory, for blocks of size b, instead of
+     * O(n^2) for a dense rotation.
+     */
+    class BlockRotation
+    {
+        size_t n_ = 0;
+        size_t block_size_ = 0;
+
+        //! The rows of B in the order of P_l, so that row i computes the i-th element of the result
+        common::Matrix<double> rows_;
+
+        //! The first variable of the block of each row
+        std::vector<size_t> starts_;
+
+        //! The size of the block of each row
+        std::vector<size_t> widths_;
+
+        //! The permutation P_r, element j of P_r * x is x[input_[j]]
+        std::vector<size_t> input_;
+
+        /**
+         * \brief Orthogonalizes the columns of a square matrix with classical Gram-Schmidt, as
+         * bbob::TransformationState::compute_rotation does for the dense rotations
+         */
+        static void orthogonalize(common::Matrix<double> &matrix, const size_t n)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                for (size_t j = 0; j < i; j++)
+                {
+                    auto prod = 0.0;
+                    for (size_t k = 0; k < n; k++)
+                        prod += matrix[k][i] * matrix[k][j];
+
+                    for (size_t k = 0; k < n; k++)
+                        matrix[k][i] -= prod * matrix[k][j];
+                }
+                auto prod = 0.0;
+                for (size_t k = 0; k < n; k++)
+                    prod += matrix[k][i] * matrix[k][i];
+
+                for (size_t k = 0; k < n; k++)
+                    matrix[k][i] /= sqrt(prod);
+            }
+        }
+
+    public:
+        BlockRotation() = default;
+
+        /**
+         * \brief Draws a random block rotation
+         * \param n the number of variables
+         * \param block_size the size of the blocks of B, of which only the last one can be smaller
+         * \param seed the seed of the rotation
+         */
+        BlockRotation(const size_t n, const size_t block_size, const long seed) :
+            n_(n), block_size_(block_size), rows_(n, block_size), starts_(n), widths_(n),
+            input_(permutation(n, block_size, seed + 2000000))
+        {
+            size_t n_normals = 0;
+            for (size_t start = 0; start < n; start += block_size)
+                n_normals += std::min(block_size, n - start) * std::min(block_size, n - start);
+            const auto random_vector = common::random::normal(n_normals, seed);
+
+            const auto output = permutation(n, block_size, seed + 3000000);
+            std::vector<size_t> position(n);
+            for (size_t i = 0; i < n; ++i)
+                position[output[i]] = i;
+
+            auto offset = random_vector.begin();
+            for (size_t start = 0; start < n; start += block_size)
+            {
+                const auto width = std::min(block_size, n - start);
+                auto block = common::Matrix<double>(width, width);
+                for (size_t i = 0; i < width; i++)
+                    for (size_t j = 0; j < width; j++)
+                        block[i][j] = offset[static_cast<std::ptrdiff_t>(j * width + i)];
+                offset += static_cast<std::ptrdiff_t>(width * width);
+                orthogonalize(block, width);
+
+                for (size_t i = 0; i < width; i++)
+                {
+                    const auto row = position[start + i];
+                    std::copy_n(block[i], width, rows_[row]);
+                    starts_[row] = start;
+                    widths_[row] = width;
+                }
+            }
+        }
+
+        /**
+         * \brief A random permutation which swaps every variable, in random order, with a variable which is at
+         * most swap_range places away
+         * \param n the number of variables
+         * \param swap_range the largest distance of a swap
+         * \param seed the seed of the permutation
+         * \return the permutation, element i of the permuted vector is the element at the i-th index
+         */
+        static std::vector<size_t> permutation(const size_t n, const size_t swap_range, const long seed)
+        {
+            const auto random_numbers = common::random::uniform(2 * n, seed);
+
+            std::vector<size_t> order(n);
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&random_numbers](const size_t a, const size_t b) {
+                return random_numbers[a] < random_numbers[b];
+            });
+
+            std::vector<size_t> indices(n);
+            std::iota(indices.begin(), indices.end(), 0);
+            for (size_t i = 0; i < n; ++i)
+            {
+                const auto first = order[i];
+                const auto lower = first > swap_range ? first - swap_range : 0;
+                const auto upper = std::min(first + swap_range, n - 1);
+                const auto second = std::min(upper, lower + static_cast<size_t>(
+                    random_numbers[n + i] * static_cast<double>(upper - lower + 1)));
+                std::swap(indices[first], indices[second]);
+            }
+            return indices;
+        }
+
+        [[nodiscard]] size_t size() const { return n_; }
+
+        [[nodiscard]] size_t block_size() const { return block_size_; }
+
+        /**
+         * \brief Computes y = P_l * B * P_r * x
+         * \param x the vector which is rotated, with size() elements
+         * \param y the result, which may be the same as x
+         * \param buffer work space, with size() elements, which should overlap with neither x nor y
+         */
+        void apply(const double *x, double *y, double *buffer) const
+        {
+            for (size_t j = 0; j < n_; ++j)
+                buffer[j] = x[input_[j]];
+
+            for (size_t i = 0; i < n_; ++i)
+                common::simd::affine(rows_[i], rows_.stride(), nullptr, buffer + starts_[i], y + i, 1, widths_[i]);
+        }
+
+        /**
+         * \brief Computes y = (P_l * B * P_r)^T * x, the inverse of apply
+         * \param x the vector which is rotated, with size() elements
+         * \param y the result, which may be the same as x
+         * \param buffer work space, with size() elements, which should overlap with neither x nor y
+         */
+        void apply_transpose(const double *x, double *y, double *buffer) const
+        {
+            std::fill(buffer, buffer + n_, 0.0);
+            for (size_t i = 0; i < n_; ++i)
+                for (size_t k = 0; k < widths_[i]; ++k)
+                    buffer[starts_[i] + k] += rows_[i][k] * x[i];
+
+            for (size_t j = 0; j < n_; ++j)
+                y[input_[j]] = buffer[j];
+        }
+    };
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleBuecheRastrigin final : public LargeScaleBBOProblem<LargeScaleBuecheRastrigin>
+    {
+        static constexpr double penalty_factor_ = 100.0;
+        std::vector<double> brs_factors_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::rastrigin(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            oscillate(x);
+            brs(x, brs_factors_);
+            return x;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            using namespace transformation::objective;
+            return penalize(current().x, constraint_, penalty_factor_, shift(y, objective_.y));
+        }
+
+    public:
+        LargeScaleBuecheRastrigin(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(4, instance, n_variables, "LargeScaleBuecheRastrigin"),
+            brs_factors_(transformation::variables::brs_factors(n_variables))
+        {
+            for (size_t i = 0; i < objective_.x.size(); i += 2)
+                objective_.x[i] = fabs(objective_.x[i]);
+        }
+    };
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleDifferentPowers final : public LargeScaleBBOProblem<LargeScaleDifferentPowers>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::different_powers(x.data(), x.size(), transformation_state_->exponents.data());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transformation::variables::subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            return x;
+        }
+
+    public:
+        LargeScaleDifferentPowers(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(14, instance, n_variables, "LargeScaleDifferentPowers")
+        {
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+                transformation_state_->exponents[i] = 2.0 + 4.0 * transformation_state_->exponents.at(i);
+        }
+    };
+}
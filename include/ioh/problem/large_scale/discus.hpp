@@ -0,0 +1,30 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleDiscus final : public LargeScaleBBOProblem<LargeScaleDiscus>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::discus(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            oscillate(x);
+            return x;
+        }
+
+    public:
+        LargeScaleDiscus(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(11, instance, n_variables, "LargeScaleDiscus")
+        {
+        }
+    };
+}
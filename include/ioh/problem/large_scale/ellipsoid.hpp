@@ -0,0 +1,32 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleEllipsoid final : public LargeScaleBBOProblem<LargeScaleEllipsoid>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::ellipsoid(x.data(), x.size(), transformation_state_->conditions.data());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            oscillate(x);
+            return x;
+        }
+
+    public:
+        LargeScaleEllipsoid(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(2, instance, n_variables, "LargeScaleEllipsoid")
+        {
+            static const auto condition = 1.0e6;
+            for (auto i = 1; i < meta_data_.n_variables; ++i)
+                transformation_state_->conditions[i] = pow(condition, transformation_state_->exponents.at(i));
+        }
+    };
+}
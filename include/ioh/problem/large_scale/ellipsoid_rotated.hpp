@@ -0,0 +1,33 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleEllipsoidRotated final : public LargeScaleBBOProblem<LargeScaleEllipsoidRotated>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::ellipsoid(x.data(), x.size(), transformation_state_->conditions.data());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            oscillate(x);
+            return x;
+        }
+
+    public:
+        LargeScaleEllipsoidRotated(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(10, instance, n_variables, "LargeScaleEllipsoidRotated")
+        {
+            static const auto condition = 1.0e6;
+            for (auto i = 1; i < meta_data_.n_variables; ++i)
+                transformation_state_->conditions[i] = pow(condition, transformation_state_->exponents.at(i));
+        }
+    };
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+#include "ioh/problem/bbob/gallagher101.hpp"
+
+namespace ioh::problem::large_scale
+{
+    template <typename T>
+    class LargeScaleGallagher : public LargeScaleBBOProblem<T>
+    {
+        //! Owns the location and shape of the peaks, which are shared between clones of a problem
+        std::shared_ptr<bbob::kernels::GallagherPeaks> landscape_;
+        double factor_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            auto &x_transformed = common::thread_local_buffer<double, LargeScaleGallagher>(
+                this->meta_data_.n_variables);
+            auto penalty = 0.;
+
+            for (auto i = 0; i < this->meta_data_.n_variables; i++)
+            {
+                const auto out_of_bounds = fabs(x.at(i)) - 5.;
+                if (out_of_bounds > 0.)
+                    penalty += out_of_bounds * out_of_bounds;
+            }
+            this->transformation_state_->second_rotation.apply(x.data(), x_transformed.data(),
+                                                              this->transformation_buffer().data());
+            return bbob::kernels::gallagher(x_transformed.data(), x_transformed.size(), *landscape_, factor_) + penalty;
+        }
+
+    public:
+        LargeScaleGallagher(const int problem_id, const int instance, const int n_variables, const std::string &name,
+                            const int number_of_peaks, const double b = 10., const double c = 5.0,
+                            double max_condition = sqrt(1000.)) :
+            LargeScaleBBOProblem<T>(problem_id, instance, n_variables, name),
+            landscape_(std::make_shared<bbob::kernels::GallagherPeaks>(bbob::gallagher::peaks(
+                number_of_peaks, n_variables, this->transformation_state_->seed, max_condition))),
+            factor_(-0.5 / static_cast<double>(n_variables))
+        {
+            const auto random_numbers = common::random::bbob2009::uniform(
+                this->meta_data_.n_variables * number_of_peaks, this->transformation_state_->seed);
+
+            std::vector<double> center(n_variables);
+            for (auto j = 0; j < number_of_peaks; ++j)
+            {
+                for (auto k = 0; k < n_variables; ++k)
+                    center[k] = b * random_numbers.at(j * n_variables + k) - c;
+                this->rotate(center, this->transformation_state_->second_rotation);
+
+                for (auto i = 0; i < n_variables; ++i)
+                    landscape_->centers[j][i] = j == 0 ? 0.8 * center[i] : center[i];
+            }
+
+            for (auto i = 0; i < n_variables; ++i)
+                this->objective_.x[i] = 0.8 * (b * random_numbers[i] - c);
+        }
+    };
+
+    class LargeScaleGallagher101 final : public LargeScaleGallagher<LargeScaleGallagher101>
+    {
+    public:
+        LargeScaleGallagher101(const int instance, const int n_variables) :
+            LargeScaleGallagher(21, instance, n_variables, "LargeScaleGallagher101", 101, 10., 5.0)
+        {
+        }
+    };
+}
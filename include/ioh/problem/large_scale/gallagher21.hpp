@@ -0,0 +1,15 @@
+#pragma once
+
+#include "gallagher101.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleGallagher21 final : public LargeScaleGallagher<LargeScaleGallagher21>
+    {
+    public:
+        LargeScaleGallagher21(const int instance, const int n_variables) :
+            LargeScaleGallagher(22, instance, n_variables, "LargeScaleGallagher21", 21, 9.8, 4.9, 1000.)
+        {
+        }
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleGriewankRosenBrock final : public LargeScaleBBOProblem<LargeScaleGriewankRosenBrock>
+    {
+        double factor_;
+        std::vector<double> x_shift_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::griewank_rosenbrock(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            rotate(x, transformation_state_->second_rotation);
+            scale(x, factor_);
+            subtract(x, x_shift_);
+            return x;
+        }
+
+    public:
+        LargeScaleGriewankRosenBrock(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(19, instance, n_variables, "LargeScaleGriewankRosenBrock"),
+            factor_(std::max(1., sqrt(n_variables) / 8.)), x_shift_(n_variables, -0.5)
+        {
+            objective_.x = rosenbrock_optimum(transformation_state_->second_rotation, factor_);
+        }
+    };
+}
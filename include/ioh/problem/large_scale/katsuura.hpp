@@ -0,0 +1,40 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleKatsuura final : public LargeScaleBBOProblem<LargeScaleKatsuura>
+    {
+        double exponent_;
+        double factor_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::katsuura(x.data(), x.size(), exponent_, factor_);
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transformation::variables::subtract(x, objective_.x);
+            second_transformation(x);
+            return x;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            using namespace transformation::objective;
+            static const auto penalty_factor = 1.0;
+            return penalize(current().x, constraint_, penalty_factor, shift(y, objective_.y));
+        }
+
+    public:
+        LargeScaleKatsuura(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(23, instance, n_variables, "LargeScaleKatsuura", sqrt(100.0)),
+            exponent_(10. / pow(static_cast<double>(meta_data_.n_variables), 1.2)),
+            factor_(10. / static_cast<double>(meta_data_.n_variables) / static_cast<double>(meta_data_.n_variables))
+        {
+        }
+    };
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include "ioh/problem/bbob/bbob_problem.hpp"
+#include "ioh/problem/large_scale/block_rotation.hpp"
+
+namespace ioh::problem
+{
+    /**
+     * \brief The large-scale variant of the BBOB problems. The functions are the same, but the dense rotations are
+     * replaced by permuted block-diagonal rotations (see large_scale::BlockRotation), so that a problem can be
+     * constructed and evaluated in O(n * b) time and memory, for blocks of size b = min(40, n). This makes
+     * dimensions in the thousands practical.
+     */
+    class LargeScaleBBOB : public Real
+    {
+    protected:
+        struct TransformationState
+        {
+            long seed;
+            std::vector<double> exponents{};
+            std::vector<double> conditions{};
+
+            //! The diagonal condition^(i / (n - 1)) between the two rotations of second_transformation
+            std::vector<double> condition_scales{};
+            large_scale::BlockRotation first_rotation{};
+            large_scale::BlockRotation second_rotation{};
+
+            TransformationState(const long problem_id, const int instance, const int n_variables,
+                                const double condition = sqrt(10.0)) :
+                seed((problem_id == 4 || problem_id == 18 ? problem_id - 1 : problem_id) + 10000 * instance),
+                exponents(n_variables),
+                conditions(n_variables),
+                condition_scales(n_variables),
+                first_rotation(static_cast<size_t>(n_variables), block_size(n_variables), seed + 1000000),
+                second_rotation(static_cast<size_t>(n_variables), block_size(n_variables), seed)
+            {
+                for (auto i = 0; i < n_variables; ++i)
+                {
+                    exponents[i] = static_cast<double>(i) / (static_cast<double>(n_variables) - 1);
+                    condition_scales[i] = pow(condition, exponents[i]);
+                }
+            }
+
+            //! The size of the blocks of the rotations
+            static size_t block_size(const int n_variables)
+            {
+                return static_cast<size_t>(std::min(40, n_variables));
+            }
+        };
+
+        //! Owns the transformation state, which is shared between clones of a problem
+        std::shared_ptr<TransformationState> shared_transformation_state_;
+
+        /**
+         * \brief The transformation state, which is immutable once the problem is constructed. It points into
+         * shared_transformation_state_, rather than referring to it, so that the problems are copy assignable.
+         */
+        TransformationState *transformation_state_;
+
+        //! Work space for the rotations, which is private to the calling thread
+        [[nodiscard]]
+        std::vector<double> &transformation_buffer() const
+        {
+            return common::thread_local_buffer<double, LargeScaleBBOB>(meta_data_.n_variables);
+        }
+
+        //! Rotates x in place
+        void rotate(std::vector<double> &x, const large_scale::BlockRotation &rotation) const
+        {
+            rotation.apply(x.data(), x.data(), transformation_buffer().data());
+        }
+
+        /**
+         * \brief The large-scale counterpart of BBOB's second_transformation_matrix: x is rotated by the second
+         * rotation, scaled by condition_scales and rotated by the first rotation
+         */
+        void second_transformation(std::vector<double> &x) const
+        {
+            rotate(x, transformation_state_->second_rotation);
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] *= transformation_state_->condition_scales[i];
+            rotate(x, transformation_state_->first_rotation);
+        }
+
+        /**
+         * \brief Computes rotation^T * 1 / (2 * factor), the optimum of the rotated Rosenbrock functions, which are
+         * evaluated at factor * rotation * x + 0.5
+         */
+        [[nodiscard]]
+        std::vector<double> rosenbrock_optimum(const large_scale::BlockRotation &rotation, const double factor) const
+        {
+            std::vector<double> x(meta_data_.n_variables, 1.0 / (2. * factor));
+            rotation.apply_transpose(x.data(), x.data(), transformation_buffer().data());
+            return x;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            return transformation::objective::shift(y, objective_.y);
+        }
+
+    public:
+        LargeScaleBBOB(const int problem_id, const int instance, const int n_variables, const std::string &name,
+                       const double condition = sqrt(10.0)) :
+            Real(MetaData(problem_id, instance, name, n_variables, common::OptimizationType::Minimization),
+                 Constraint<double>(n_variables, 5, -5)),
+            shared_transformation_state_(
+                std::make_shared<TransformationState>(problem_id, instance, n_variables, condition)),
+            transformation_state_(shared_transformation_state_.get())
+        {
+            objective_ = BBOB::calculate_objective(problem_id, transformation_state_->seed, n_variables);
+            log_info_.objective = objective_;
+        }
+
+        void update_log_info() override
+        {
+            log_info_.evaluations = static_cast<size_t>(state_.evaluations);
+            log_info_.y_best = state_.current_best.y - objective_.y;
+            log_info_.transformed_y = state_.current.y;
+            log_info_.transformed_y_best = state_.current_best.y;
+            log_info_.current = state_.current;
+            log_info_.current.y = log_info_.current.y - objective_.y;
+        }
+    };
+
+    /**
+     * \brief CRTP base of the large-scale problems. They are only registered with the LargeScaleBBOB factory, since
+     * their ids coincide with the ids of the BBOB problems.
+     */
+    template <typename ProblemType>
+    class LargeScaleBBOProblem : public LargeScaleBBOB, AutomaticProblemRegistration<ProblemType, LargeScaleBBOB>
+    {
+    public:
+        LargeScaleBBOProblem(const int problem_id, const int instance, const int n_variables,
+                             const std::string &name, const double condition = sqrt(10.0)) :
+            LargeScaleBBOB(problem_id, instance, n_variables, name, condition)
+        {
+        }
+
+        [[nodiscard]]
+        std::unique_ptr<Real> clone() const override
+        {
+            return std::make_unique<ProblemType>(static_cast<const ProblemType &>(*this));
+        }
+    };
+}
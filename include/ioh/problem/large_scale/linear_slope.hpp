@@ -0,0 +1,34 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleLinearSlope final : public LargeScaleBBOProblem<LargeScaleLinearSlope>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::linear_slope(x.data(), x.size(), transformation_state_->conditions.data(),
+                                               objective_.x.data());
+        }
+
+    public:
+        LargeScaleLinearSlope(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(5, instance, n_variables, "LargeScaleLinearSlope")
+        {
+            static const auto base = sqrt(100.0);
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+                if (objective_.x.at(i) < 0.0)
+                {
+                    objective_.x[i] = constraint_.lb.at(0);
+                    transformation_state_->conditions[i] = -pow(base, transformation_state_->exponents.at(i));
+                }
+                else
+                {
+                    objective_.x[i] = constraint_.ub.at(0);
+                    transformation_state_->conditions[i] = pow(base, transformation_state_->exponents.at(i));
+                }
+        }
+    };
+}
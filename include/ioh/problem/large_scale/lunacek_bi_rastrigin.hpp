@@ -0,0 +1,48 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleLunacekBiRastrigin final : public LargeScaleBBOProblem<LargeScaleLunacekBiRastrigin>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            static const auto mu0 = 2.5;
+            auto penalty = 0.;
+
+            auto &x_hat = common::thread_local_buffer<double, LargeScaleLunacekBiRastrigin, 0>(meta_data_.n_variables);
+            auto &z = common::thread_local_buffer<double, LargeScaleLunacekBiRastrigin, 1>(meta_data_.n_variables);
+
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            {
+                x_hat[i] = objective_.x.at(i) > 0. ? 2. * x.at(i) : 2. * x.at(i) * -1;
+                z[i] = x_hat[i] - mu0;
+
+                const auto out_of_bounds = fabs(x[i]) - 5.0;
+                if (out_of_bounds > 0.0)
+                    penalty += out_of_bounds * out_of_bounds;
+            }
+
+            rotate(z, transformation_state_->second_rotation);
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+                z[i] *= transformation_state_->conditions[i];
+            rotate(z, transformation_state_->first_rotation);
+
+            return bbob::kernels::lunacek_bi_rastrigin(x_hat.data(), z.data(), z.size()) + 1e4 * penalty;
+        }
+
+    public:
+        LargeScaleLunacekBiRastrigin(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(24, instance, n_variables, "LargeScaleLunacekBiRastrigin")
+        {
+            const auto signs = transformation::variables::random_signs(n_variables, transformation_state_->seed);
+            for (auto i = 0; i < n_variables; ++i)
+            {
+                objective_.x[i] = signs.at(i) * 0.5 * 2.5;
+                transformation_state_->conditions[i] = pow(sqrt(100.), transformation_state_->exponents.at(i));
+            }
+        }
+    };
+}
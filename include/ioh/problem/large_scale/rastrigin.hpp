@@ -0,0 +1,36 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleRastrigin final : public LargeScaleBBOProblem<LargeScaleRastrigin>
+    {
+        std::vector<double> asymmetric_coefficients_;
+        std::vector<double> conditioning_factors_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::rastrigin(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            oscillate(x);
+            asymmetric(x, asymmetric_coefficients_);
+            conditioning(x, conditioning_factors_);
+            return x;
+        }
+
+    public:
+        LargeScaleRastrigin(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(3, instance, n_variables, "LargeScaleRastrigin"),
+            asymmetric_coefficients_(transformation::variables::asymmetric_coefficients(n_variables, 0.2)),
+            conditioning_factors_(transformation::variables::conditioning_factors(n_variables, 10.0))
+        {
+        }
+    };
+}
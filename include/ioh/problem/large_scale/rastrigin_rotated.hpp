@@ -0,0 +1,35 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleRastriginRotated final : public LargeScaleBBOProblem<LargeScaleRastriginRotated>
+    {
+        std::vector<double> asymmetric_coefficients_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::rastrigin(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            oscillate(x);
+            asymmetric(x, asymmetric_coefficients_);
+            second_transformation(x);
+            return x;
+        }
+
+    public:
+        LargeScaleRastriginRotated(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(15, instance, n_variables, "LargeScaleRastriginRotated"),
+            asymmetric_coefficients_(transformation::variables::asymmetric_coefficients(n_variables, 0.2))
+        {
+        }
+    };
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleRosenbrock final : public LargeScaleBBOProblem<LargeScaleRosenbrock>
+    {
+        double factor_;
+        std::vector<double> negative_one_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::rosenbrock(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            scale(x, factor_);
+            subtract(x, negative_one_);
+            return x;
+        }
+
+    public:
+        LargeScaleRosenbrock(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(8, instance, n_variables, "LargeScaleRosenbrock"),
+            factor_(std::max(1.0, std::sqrt(n_variables) / 8.0)), negative_one_(n_variables, -1)
+        {
+            for (auto &e : objective_.x)
+                e *= 0.75;
+        }
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleRosenbrockRotated final : public LargeScaleBBOProblem<LargeScaleRosenbrockRotated>
+    {
+        double factor_;
+        std::vector<double> negative_half_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::rosenbrock(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            rotate(x, transformation_state_->second_rotation);
+            scale(x, factor_);
+            subtract(x, negative_half_);
+            return x;
+        }
+
+    public:
+        LargeScaleRosenbrockRotated(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(9, instance, n_variables, "LargeScaleRosenbrockRotated"),
+            factor_(std::max(1.0, std::sqrt(n_variables) / 8.0)), negative_half_(n_variables, -0.5)
+        {
+            objective_.x = rosenbrock_optimum(transformation_state_->second_rotation, factor_);
+        }
+    };
+}
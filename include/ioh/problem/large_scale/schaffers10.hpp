@@ -0,0 +1,60 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    template <typename T>
+    class LargeScaleSchaffers : public LargeScaleBBOProblem<T>
+    {
+        std::vector<double> asymmetric_coefficients_;
+
+        //! The scaling sqrt(condition)^(i / (n - 1)) which follows the second rotation
+        std::vector<double> scales_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::schaffers(x.data(), x.size());
+        }
+
+        double transform_objectives(const double y) override
+        {
+            using namespace transformation::objective;
+            static const auto penalty_factor = 10.0;
+            return penalize<double>(this->current().x, this->constraint_, penalty_factor,
+                                    shift(y, this->objective_.y));
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, this->objective_.x);
+            this->rotate(x, this->transformation_state_->first_rotation);
+            asymmetric(x, asymmetric_coefficients_);
+            this->rotate(x, this->transformation_state_->second_rotation);
+            conditioning(x, scales_);
+            return x;
+        }
+
+    public:
+        LargeScaleSchaffers(const int problem_id, const int instance, const int n_variables, const std::string &name,
+                            const double condition) :
+            LargeScaleBBOProblem<T>(problem_id, instance, n_variables, name),
+            asymmetric_coefficients_(transformation::variables::asymmetric_coefficients(n_variables, 0.5)),
+            scales_(n_variables)
+        {
+            for (auto i = 0; i < n_variables; ++i)
+                scales_[i] = pow(sqrt(condition), this->transformation_state_->exponents.at(i));
+        }
+    };
+
+    class LargeScaleSchaffers10 final : public LargeScaleSchaffers<LargeScaleSchaffers10>
+    {
+    public:
+        LargeScaleSchaffers10(const int instance, const int n_variables) :
+            LargeScaleSchaffers(17, instance, n_variables, "LargeScaleSchaffers10", 10.0)
+        {
+        }
+    };
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "schaffers10.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleSchaffers1000 final : public LargeScaleSchaffers<LargeScaleSchaffers1000>
+    {
+    public:
+        LargeScaleSchaffers1000(const int instance, const int n_variables) :
+            LargeScaleSchaffers(18, instance, n_variables, "LargeScaleSchaffers1000", 1000.0)
+        {
+        }
+    };
+}
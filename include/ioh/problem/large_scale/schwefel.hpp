@@ -0,0 +1,50 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    //! Schwefel has no rotations, so the large-scale variant only differs from bbob::Schwefel in its suite
+    class LargeScaleSchwefel final : public LargeScaleBBOProblem<LargeScaleSchwefel>
+    {
+        std::vector<double> signs_;
+        std::vector<double> negative_offset_;
+        std::vector<double> positive_offset_;
+        std::vector<double> conditioning_factors_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::schwefel(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            random_sign_flip(x, signs_);
+            scale(x, 2);
+            z_hat(x, objective_.x);
+            subtract(x, positive_offset_);
+            conditioning(x, conditioning_factors_);
+            subtract(x, negative_offset_);
+            scale(x, 100);
+            return x;
+        }
+
+    public:
+        LargeScaleSchwefel(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(20, instance, n_variables, "LargeScaleSchwefel"),
+            signs_(transformation::variables::random_signs(n_variables, transformation_state_->seed)),
+            negative_offset_(n_variables),
+            positive_offset_(n_variables),
+            conditioning_factors_(transformation::variables::conditioning_factors(n_variables, 10.0))
+        {
+            for (auto i = 0; i < n_variables; ++i)
+            {
+                objective_.x[i] = signs_.at(i) * 0.5 * 4.2096874637;
+                negative_offset_[i] = -2 * fabs(objective_.x.at(i));
+                positive_offset_[i] = 2 * fabs(objective_.x.at(i));
+            }
+        }
+    };
+}
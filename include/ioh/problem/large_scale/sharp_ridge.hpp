@@ -0,0 +1,32 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleSharpRidge final : public LargeScaleBBOProblem<LargeScaleSharpRidge>
+    {
+        int n_linear_dimensions_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::sharp_ridge(x.data(), x.size(), n_linear_dimensions_);
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transformation::variables::subtract(x, objective_.x);
+            second_transformation(x);
+            return x;
+        }
+
+    public:
+        LargeScaleSharpRidge(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(13, instance, n_variables, "LargeScaleSharpRidge"),
+            n_linear_dimensions_(static_cast<int>(
+                ceil(meta_data_.n_variables <= 40 ? 1 : meta_data_.n_variables / 40.0)))
+        {
+        }
+    };
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleSphere final : public LargeScaleBBOProblem<LargeScaleSphere>
+    {
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::sphere(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            transformation::variables::subtract(x, objective_.x);
+            return x;
+        }
+
+    public:
+        LargeScaleSphere(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(1, instance, n_variables, "LargeScaleSphere")
+        {
+        }
+    };
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleStepEllipsoid final : public LargeScaleBBOProblem<LargeScaleStepEllipsoid>
+    {
+        //! The weights 100^(i / (n - 1)) of the squared projections
+        std::vector<double> weights_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            auto penalty = 0.0;
+            auto &z = common::thread_local_buffer<double, LargeScaleStepEllipsoid>(meta_data_.n_variables);
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            {
+                const auto out_of_bounds = fabs(x.at(i)) - 5.0;
+                if (out_of_bounds > 0.0)
+                    penalty += out_of_bounds * out_of_bounds;
+                z[i] = x[i] - objective_.x[i];
+            }
+
+            rotate(z, transformation_state_->second_rotation);
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+                z[i] *= transformation_state_->conditions[i];
+
+            const auto x0 = z[0];
+            for (auto &zi : z)
+                zi = bbob::kernels::step_ellipsoid_round(zi);
+            rotate(z, transformation_state_->first_rotation);
+
+            auto result = bbob::kernels::step_ellipsoid(z.data(), z.size(), weights_.data(), x0);
+            result += penalty + objective_.y;
+            return result;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            return y;
+        }
+
+    public:
+        LargeScaleStepEllipsoid(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(7, instance, n_variables, "LargeScaleStepEllipsoid"), weights_(n_variables)
+        {
+            static const auto condition = 100.;
+            for (auto i = 0; i < meta_data_.n_variables; ++i)
+            {
+                transformation_state_->conditions[i] = sqrt(pow(condition / 10.,
+                                                               transformation_state_->exponents.at(i)));
+                weights_[i] = pow(100., transformation_state_->exponents.at(i));
+            }
+        }
+    };
+}
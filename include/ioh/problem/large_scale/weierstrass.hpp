@@ -0,0 +1,40 @@
+#pragma once
+
+#include "large_scale_problem.hpp"
+
+namespace ioh::problem::large_scale
+{
+    class LargeScaleWeierstrass final : public LargeScaleBBOProblem<LargeScaleWeierstrass>
+    {
+        double penalty_factor_;
+
+    protected:
+        double evaluate(const std::vector<double> &x) override
+        {
+            return bbob::kernels::weierstrass(x.data(), x.size());
+        }
+
+        std::vector<double> transform_variables(std::vector<double> x) override
+        {
+            using namespace transformation::variables;
+            subtract(x, objective_.x);
+            rotate(x, transformation_state_->first_rotation);
+            oscillate(x);
+            second_transformation(x);
+            return x;
+        }
+
+        double transform_objectives(const double y) override
+        {
+            using namespace transformation::objective;
+            return penalize(current().x, constraint_, penalty_factor_, shift(y, objective_.y));
+        }
+
+    public:
+        LargeScaleWeierstrass(const int instance, const int n_variables) :
+            LargeScaleBBOProblem(16, instance, n_variables, "LargeScaleWeierstrass", 1 / sqrt(100.0)),
+            penalty_factor_(10.0 / n_variables)
+        {
+        }
+    };
+}
@@ -12,47 +12,104 @@ namespace ioh
             protected:
                 int k_ = 5;
 
-                double evaluate(const std::vector<int> &x) override
+                /**
+                 * \brief The sums which determine the objective value: the number of blocks which are all ones, the
+                 * sum of k - 1 - ones over the other blocks and the number of ones in the remaining block
+                 */
+                enum Sum
+                {
+                    full_blocks,
+                    trap_sum,
+                    remainder_ones
+                };
+
+                [[nodiscard]]
+                int n_blocks() const { return meta_data_.n_variables / k_; }
+
+                [[nodiscard]]
+                int remain_k() const { return meta_data_.n_variables - n_blocks() * k_; }
+
+                // TODO: check this, the remaining block starts at m * (k - 1) instead of m * k
+                [[nodiscard]]
+                int remainder_start() const { return n_blocks() * (k_ - 1); }
+
+                [[nodiscard]]
+                int block_ones(const std::vector<int> &x, const int block) const
+                {
+                    auto result = 0;
+                    for (auto j = block * k_; j != block * k_ + k_; ++j)
+                        result += x[j];
+                    return result;
+                }
+
+                //! Adds the contribution of a block with a number of ones to the sums
+                void add_block(const int ones, const int sign, std::vector<double> &sums) const
+                {
+                    if (ones == k_)
+                        sums[full_blocks] += sign;
+                    else
+                        sums[trap_sum] += sign * (k_ - 1 - ones);
+                }
+
+                void compute_sums(const std::vector<int> &x, std::vector<double> &sums) const
+                {
+                    sums.assign(3, 0.0);
+                    for (auto i = 0; i < n_blocks(); ++i)
+                        add_block(block_ones(x, i), 1, sums);
+
+                    if (remain_k() != 0)
+                        for (auto j = remainder_start(); j != meta_data_.n_variables; ++j)
+                            sums[remainder_ones] += x[j];
+                }
+
+                [[nodiscard]]
+                double objective(const std::vector<double> &sums) const
                 {
-                    auto result = 0.0;
-                    double block_result;
-                    const auto m = meta_data_.n_variables / k_;
-                    for (auto i = 1; i <= m; ++i)
+                    auto result = sums[full_blocks] + sums[trap_sum] / static_cast<double>(k_);
+                    const auto remain = static_cast<double>(remain_k());
+                    if (remain != 0.0)
                     {
-                        block_result = 0.0;
-                        for (auto j = i * k_ - k_; j != i * k_; ++j)
-                        {
-                            block_result += x[j];
-                        }
-                        if (block_result == k_)
-                        {
+                        if (sums[remainder_ones] == remain)
                             result += 1;
-                        }
                         else
-                        {
-                            result += (static_cast<double>(k_ - 1) - block_result) / static_cast<double>(k_);
-                        }
+                            result += (remain - 1 - sums[remainder_ones]) / remain;
                     }
-                    const auto remain_k = meta_data_.n_variables - m * k_;
-                    if (remain_k != 0)
+                    return result;
+                }
+
+                double evaluate(const std::vector<int> &x) override
+                {
+                    auto &sums = common::thread_local_buffer<double, ConcatenatedTrap>(3);
+                    compute_sums(x, sums);
+                    return objective(sums);
+                }
+
+                void initialize_parent(Parent<int> &parent) override
+                {
+                    compute_sums(parent.internal.x, parent.data);
+                }
+
+                //! Only the blocks which contain a flipped bit are counted again
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &data) override
+                {
+                    const auto blocked = static_cast<size_t>(n_blocks() * k_);
+                    auto &blocks = common::thread_local_buffer<int, ConcatenatedTrap>(0);
+                    for (const auto i : flipped)
                     {
-                        block_result = 0.0;
-                        // TODO: check this, only with braces this works
-                        for (auto j = m * (k_ - 1); j != meta_data_.n_variables; ++j)
-                        {
-                            block_result += x[j];
-                        }
-                        if (block_result == remain_k)
-                        {
-                            result += 1;
-                        }
-                        else
-                        {
-                            result += static_cast<double>(remain_k - 1 - block_result) / static_cast<double>(remain_k);
-                        }
+                        if (i < blocked)
+                            blocks.push_back(static_cast<int>(i) / k_);
+                        if (remain_k() != 0 && i >= static_cast<size_t>(remainder_start()))
+                            data[remainder_ones] += x[i] - parent.x[i];
                     }
-
-                    return result;
+                    std::sort(blocks.begin(), blocks.end());
+                    blocks.erase(std::unique(blocks.begin(), blocks.end()), blocks.end());
+                    for (const auto block : blocks)
+                    {
+                        add_block(block_ones(parent.x, block), -1, data);
+                        add_block(block_ones(x, block), 1, data);
+                    }
+                    return objective(data);
                 }
 
             public:
@@ -23,6 +23,19 @@ namespace ioh
                     return result;
                 }
 
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = parent.y;
+                    for (const auto i : flipped)
+                    {
+                        const auto c = static_cast<int>(i);
+                        result += ising_edge_change(parent.x, x, c, modulo_ising_ring(c - 1, meta_data_.n_variables));
+                        result += ising_edge_change(parent.x, x, c, modulo_ising_ring(c + 1, meta_data_.n_variables));
+                    }
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Ring object. Definition refers to
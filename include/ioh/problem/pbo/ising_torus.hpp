@@ -38,6 +38,29 @@ namespace ioh
                     return result;
                 }
 
+                //! The edges of a bit go to its right and lower neighbors, and come from its left and upper ones
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = parent.y;
+                    const auto lattice_size = static_cast<int>(sqrt(static_cast<double>(meta_data_.n_variables)));
+                    for (const auto c : flipped)
+                    {
+                        if (c >= static_cast<size_t>(lattice_size * lattice_size))
+                            continue;
+                        const auto i = static_cast<int>(c) / lattice_size;
+                        const auto j = static_cast<int>(c) % lattice_size;
+                        const int neighbors[4] = {
+                            modulo_ising_torus(i + 1, lattice_size) * lattice_size + j,
+                            lattice_size * i + modulo_ising_torus(j + 1, lattice_size),
+                            modulo_ising_torus(i - 1, lattice_size) * lattice_size + j,
+                            lattice_size * i + modulo_ising_torus(j - 1, lattice_size)};
+                        for (const auto neighbor : neighbors)
+                            result += ising_edge_change(parent.x, x, static_cast<int>(c), neighbor);
+                    }
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Torus object. Definition refers to
@@ -37,6 +37,30 @@ namespace ioh
                     return static_cast<double>(result);
                 }
 
+                //! The edges of a bit go to its right, lower and lower right neighbors, and come from the opposite ones
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = parent.y;
+                    const auto lattice_size = static_cast<int>(sqrt(static_cast<double>(meta_data_.n_variables)));
+                    for (const auto c : flipped)
+                    {
+                        if (c >= static_cast<size_t>(lattice_size * lattice_size))
+                            continue;
+                        const auto i = static_cast<int>(c) / lattice_size;
+                        const auto j = static_cast<int>(c) % lattice_size;
+                        const auto down = modulo_ising_triangular(i + 1, lattice_size) * lattice_size;
+                        const auto up = modulo_ising_triangular(i - 1, lattice_size) * lattice_size;
+                        const auto right = modulo_ising_triangular(j + 1, lattice_size);
+                        const auto left = modulo_ising_triangular(j - 1, lattice_size);
+                        const int neighbors[6] = {down + j, i * lattice_size + right, down + right,
+                                                  up + j,   i * lattice_size + left,  up + left};
+                        for (const auto neighbor : neighbors)
+                            result += ising_edge_change(parent.x, x, static_cast<int>(c), neighbor);
+                    }
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Ising_Triangular object. Definition refers to
@@ -9,7 +9,17 @@ namespace ioh
         {
             class LABS final : public PBOProblem<LABS>
             {
+            public:
+                /**
+                 * \brief The length from which the correlations are computed by FFT, in O(n log n) time, instead of
+                 * directly, in O(n^2) time. This is where the FFT measured faster than the direct method.
+                 */
+                static constexpr int fft_crossover = 128;
+
             protected:
+                //! The FFT of the correlations, which is only prepared from fft_crossover on
+                common::Autocorrelation autocorrelation_;
+
                 static double correlation(const std::vector<int>& x, const int n, int k)
                 {
                     auto result = 0;
@@ -19,16 +29,75 @@ namespace ioh
                     return static_cast<double>(result);
                 }
 
+                /**
+                 * \brief Computes the correlations C_1 ... C_{n-1} of x. From fft_crossover on they are computed by
+                 * FFT and rounded, which gives the same integers as the direct method.
+                 * \param x the solution
+                 * \param correlations receives the n - 1 correlations
+                 */
+                void compute_correlations(const std::vector<int> &x, std::vector<double> &correlations) const
+                {
+                    const auto n = meta_data_.n_variables;
+                    correlations.resize(static_cast<size_t>(std::max(n - 1, 0)));
+                    if (n < fft_crossover)
+                    {
+                        for (auto k = 1; k < n; ++k)
+                            correlations[k - 1] = correlation(x, n, k);
+                        return;
+                    }
+
+                    auto &sequence = common::thread_local_buffer<double, LABS>(static_cast<size_t>(n));
+                    auto &all = common::thread_local_buffer<double, LABS, 1>(static_cast<size_t>(n));
+                    for (auto i = 0; i < n; ++i)
+                        sequence[i] = x[i] * 2 - 1;
+                    autocorrelation_(sequence.data(), all.data());
+                    for (auto k = 1; k < n; ++k)
+                        correlations[k - 1] = std::round(all[k]);
+                }
+
                 double evaluate(const std::vector<int> &x) override
+                {
+                    auto &correlations = common::thread_local_buffer<double, LABS, 2>(0);
+                    compute_correlations(x, correlations);
+                    return objective(correlations);
+                }
+
+                //! The objective value from the correlations C_1 ... C_{n-1}
+                [[nodiscard]]
+                double objective(const std::vector<double> &correlations) const
                 {
                     auto result = 0.0;
-                    for (auto k = 1; k != meta_data_.n_variables; ++k)
-                    {
-                        const auto cor = correlation(x, meta_data_.n_variables, k);
+                    for (const auto cor : correlations)
                         result += cor * cor;
+                    return static_cast<double>(meta_data_.n_variables * meta_data_.n_variables) / 2.0 / result;
+                }
+
+                //! Keeps the correlations C_1 ... C_{n-1} of a parent
+                void initialize_parent(Parent<int> &parent) override
+                {
+                    compute_correlations(parent.internal.x, parent.data);
+                }
+
+                /**
+                 * \brief Updates the correlations in O(n) per flipped bit p, since only the products of p with
+                 * p + k and p - k change in C_k. A product of two flipped bits is only updated from its lower end.
+                 */
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &data) override
+                {
+                    const auto n = meta_data_.n_variables;
+                    for (const auto i : flipped)
+                    {
+                        const auto p = static_cast<int>(i);
+                        const auto before = parent.x[p] * 2 - 1;
+                        const auto after = x[p] * 2 - 1;
+                        for (auto k = 1; p + k < n; ++k)
+                            data[k - 1] += after * (x[p + k] * 2 - 1) - before * (parent.x[p + k] * 2 - 1);
+                        for (auto k = 1; k <= p; ++k)
+                            if (x[p - k] == parent.x[p - k])
+                                data[k - 1] += (after - before) * (x[p - k] * 2 - 1);
                     }
-                    result = static_cast<double>(meta_data_.n_variables * meta_data_.n_variables) / 2.0 / result;
-                    return result;
+                    return objective(data);
                 }
 
             public:
@@ -41,7 +110,8 @@ namespace ioh
                  **/
                 LABS(const int instance, const int n_variables) : 
                 PBOProblem(18, instance, n_variables, "LABS") {
-
+                    if (n_variables >= fft_crossover)
+                        autocorrelation_ = common::Autocorrelation(static_cast<size_t>(n_variables));
                 }
             };
         } // namespace pbo
@@ -22,6 +22,24 @@ namespace ioh
                     return result;
                 }
 
+                double evaluate_bits(const common::BitString &x) override
+                {
+                    return static_cast<double>(x.leading_ones());
+                }
+
+                //! Only a flipped bit can end the ones earlier, or extend them when it is the first zero of the parent
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = static_cast<size_t>(parent.y);
+                    while (result < x.size() && x[result] == 1)
+                        ++result;
+                    for (const auto i : flipped)
+                        if (i < result && x[i] != 1)
+                            result = i;
+                    return static_cast<double>(result);
+                }
+
             public:
                 /**
                  * \brief Construct a new LeadingOnes object. Definition refers to
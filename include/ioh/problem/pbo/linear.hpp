@@ -20,6 +20,15 @@ namespace ioh
                     return result;
                 }
 
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = parent.y;
+                    for (const auto i : flipped)
+                        result += static_cast<double>(x[i] - parent.x[i]) * static_cast<double>(i + 1);
+                    return result;
+                }
+
             public:
                 /**
                  * \brief Construct a new Linear object. Definition refers to https://doi.org/10.1016/j.asoc.2019.106027
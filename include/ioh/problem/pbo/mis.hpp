@@ -30,7 +30,7 @@ namespace ioh
                     auto num_of_ones = 0;
                     auto sum_edges_in_the_set = 0;
                     auto number_of_variables_even = meta_data_.n_variables;
-                    std::vector<int> ones_array(number_of_variables_even + 1);
+                    auto &ones_array = common::thread_local_buffer<int, MIS>(number_of_variables_even + 1);
 
                     if (number_of_variables_even % 2 != 0)
                         --number_of_variables_even;
@@ -24,6 +24,20 @@ namespace ioh
                     return std::accumulate(x.begin(), x.end(), 0.0);
                 }
 
+                double evaluate_bits(const common::BitString &x) override
+                {
+                    return static_cast<double>(x.count());
+                }
+
+                double evaluate_incrementally(const Solution<int> &parent, const std::vector<int> &x,
+                                              const std::vector<size_t> &flipped, std::vector<double> &) override
+                {
+                    auto result = parent.y;
+                    for (const auto i : flipped)
+                        result += x[i] - parent.x[i];
+                    return result;
+                }
+
             public:
                 OneMax(const int instance, const int n_variables) :
                     PBOProblem(1, instance, n_variables, "OneMax")
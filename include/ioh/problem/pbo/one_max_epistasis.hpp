@@ -11,10 +11,10 @@ namespace ioh
             class OneMaxEpistasis final: public PBOProblem<OneMaxEpistasis>
             {
             protected:
-
                 double evaluate(const std::vector<int> &x) override
                 {
-                    auto new_variables = utils::epistasis(x, 4);
+                    auto &new_variables = common::thread_local_buffer<int, OneMaxEpistasis>(0);
+                    utils::epistasis(x, 4, new_variables);
                     auto result = 0.0;
                     for (size_t i = 0; i != new_variables.size(); ++i)
                         result += new_variables[i];
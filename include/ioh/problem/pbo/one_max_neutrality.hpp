@@ -13,7 +13,8 @@ namespace ioh
             protected:
                 double evaluate(const std::vector<int> &x) override
                 {
-                    auto new_variables = utils::neutrality(x, 3);
+                    auto &new_variables = common::thread_local_buffer<int, OneMaxNeutrality>(0);
+                    utils::neutrality(x, 3, new_variables);
                     auto result = 0.0;
                     for (size_t i = 0; i != new_variables.size(); ++i)
                         result += new_variables[i];
@@ -1,33 +1,80 @@
 #pragma once
 
 #include "ioh/problem/problem.hpp"
+#include "ioh/problem/transformation.hpp"
 
 namespace ioh::problem
 {
     class PBO : public Integer
     {
     protected:
+        //! The transformation of the instance
+        transformation::PseudoBooleanTransformation instance_transformation_;
+
         std::vector<int> transform_variables(std::vector<int> x) override
         {
-            if (meta_data_.instance > 1 && meta_data_.instance <= 50)
-                transformation::variables::random_flip(x, meta_data_.instance);
-            else if (meta_data_.instance > 50 && meta_data_.instance <= 100)
-                transformation::variables::random_reorder(x, meta_data_.instance);
+            instance_transformation_.transform_variables(x);
             return x;
         }
 
+        void transform_bits(common::BitString &x) override { instance_transformation_.transform_bits(x); }
+
+        /**
+         * \brief Evaluates a transformed solution incrementally, from a transformed parent which differs from it in
+         * a few flipped bits. Problems which can do this in less than the time of a full evaluation override it,
+         * the default calls evaluate.
+         * \param parent the transformed parent and its raw objective value
+         * \param x the transformed solution
+         * \param flipped the distinct indices of the bits of the transformed parent which are flipped in x
+         * \param data the problem specific data of x, which holds that of the parent on entry
+         * \return the raw objective value of x
+         */
+        [[nodiscard]]
+        virtual double evaluate_incrementally(const Solution<int> & /* parent */, const std::vector<int> &x,
+                                              const std::vector<size_t> & /* flipped */,
+                                              std::vector<double> & /* data */)
+        {
+            return evaluate(x);
+        }
+
+        /**
+         * \brief The change of the term of an edge (c, j) of an Ising model when bit c of the parent is flipped. An
+         * edge between two flipped bits is only counted from its lower end, and a self loop never changes.
+         * \param parent the transformed parent
+         * \param x the transformed solution
+         * \param c the flipped bit
+         * \param j the other end of the edge
+         */
+        static double ising_edge_change(const std::vector<int> &parent, const std::vector<int> &x, const int c,
+                                        const int j)
+        {
+            if (j == c || (x[j] != parent[j] && j < c))
+                return 0.0;
+            return (x[c] * x[j] + (1 - x[c]) * (1 - x[j])) -
+                (parent[c] * parent[j] + (1 - parent[c]) * (1 - parent[j]));
+        }
+
+        //! Both instance transformations move a flipped variable to a flipped bit of the transformed solution
+        double evaluate_flipped(const Parent<int> &parent, const std::vector<size_t> &flipped,
+                                const std::vector<int> & /* x */, std::vector<int> &internal,
+                                std::vector<double> &data) override
+        {
+            const auto &moved = instance_transformation_.transform_flips(flipped);
+            for (const auto i : moved)
+                internal[i] = static_cast<int>(internal[i] == 0);
+            return evaluate_incrementally(parent.internal, internal, moved, data);
+        }
+
         double transform_objectives(const double y) override
         {
-            using namespace transformation::objective;
-            if (meta_data_.instance > 1)
-                return uniform(shift, uniform(scale, y, meta_data_.instance, 0.2, 5.0), meta_data_.instance, -1e3, 1e3);
-            return y;
+            return instance_transformation_.transform_objectives(y);
         }
 
     public:
         PBO(const int problem_id, const int instance, const int n_variables, const std::string &name) :
             Integer(MetaData(problem_id, instance, name, n_variables,
-                             common::OptimizationType::Maximization))
+                             common::OptimizationType::Maximization)),
+            instance_transformation_(instance, n_variables, 0.2, 5.0, -1e3, 1e3)
         {
         }
     };
@@ -39,5 +86,11 @@ namespace ioh::problem
     {
     public:
         using PBO::PBO;
+
+        [[nodiscard]]
+        std::unique_ptr<Integer> clone() const override
+        {
+            return std::make_unique<ProblemType>(static_cast<const ProblemType &>(*this));
+        }
     };
 }
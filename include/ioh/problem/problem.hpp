@@ -10,6 +10,185 @@ namespace ioh
         template <typename T>
         class Problem
         {
+            /**
+             * \brief The solutions of a single thread, when a problem is evaluated concurrently
+             */
+            struct ThreadContext
+            {
+                Solution<T> current;
+                Solution<T> current_internal;
+                Solution<T> best;
+                Solution<T> best_internal;
+                //! The number of the last evaluation performed by this thread, 0 if there is none
+                int evaluation = 0;
+                //! The number of the evaluation at which best was found, 0 if there is none
+                int best_evaluation = 0;
+                //! The thread which evaluates on this context
+                std::thread::id thread{};
+                ThreadContext *next = nullptr;
+            };
+
+            /**
+             * \brief The bookkeeping for concurrent evaluations. The thread contexts form a lock-free list, which
+             * is owned by the problem.
+             */
+            struct Concurrency
+            {
+                bool enabled = false;
+                //! Identifies the problem in the thread local cache of contexts, and is never reused
+                size_t id;
+                //! The number of evaluations which have been started, which hands out the evaluation numbers
+                std::atomic<int> evaluations{0};
+                //! The number of evaluations which have been committed to the state, in order, when logging
+                std::atomic<int> committed{0};
+                std::atomic<double> best_y{0.};
+                std::atomic<ThreadContext *> contexts{nullptr};
+
+                Concurrency() : id(next_id()) {}
+
+                Concurrency(const Concurrency &) = delete;
+
+                Concurrency &operator=(const Concurrency &) = delete;
+
+                ~Concurrency()
+                {
+                    for (auto *context = contexts.load(); context != nullptr;)
+                        delete std::exchange(context, context->next);
+                }
+
+                static size_t next_id()
+                {
+                    static std::atomic<size_t> id{0};
+                    return ++id;
+                }
+            } concurrency_;
+
+            static const Solution<T> *&evaluating()
+            {
+                thread_local const Solution<T> *solution = nullptr;
+                return solution;
+            }
+
+            /**
+             * \brief The context of the calling thread, which is found in the list of contexts of the problem, or
+             * added to it. Each thread caches only the context which it used last, keyed by the id of its problem,
+             * so the cache does not grow with the number of problems. The cached pointer of a destroyed problem is
+             * never dereferenced, since ids are never reused.
+             */
+            ThreadContext &thread_context()
+            {
+                thread_local std::pair<size_t, ThreadContext *> last{0, nullptr};
+                if (last.first == concurrency_.id)
+                    return *last.second;
+
+                const auto thread = std::this_thread::get_id();
+                auto *context = concurrency_.contexts.load();
+                while (context != nullptr && context->thread != thread)
+                    context = context->next;
+
+                if (context == nullptr)
+                {
+                    context = new ThreadContext{};
+                    context->thread = thread;
+                    context->next = concurrency_.contexts.load();
+                    while (!concurrency_.contexts.compare_exchange_weak(context->next, context))
+                    {
+                    }
+                }
+                last = {concurrency_.id, context};
+                return *context;
+            }
+
+            /**
+             * \brief Merges the results of concurrent evaluations into a state. Evaluations should not be running
+             * while this happens.
+             */
+            void merge_concurrent_state(State<T> &state) const
+            {
+                state.materialize();
+                state.evaluations = concurrency_.evaluations.load();
+
+                const ThreadContext *last = nullptr;
+                for (const auto *context = concurrency_.contexts.load(); context != nullptr; context = context->next)
+                {
+                    if (context->best_evaluation != 0 &&
+                        (common::compare_objectives(context->best.y, state.current_best.y,
+                                                    meta_data_.optimization_type) ||
+                         (context->best.y == state.current_best.y &&
+                          context->best_evaluation < state.best_evaluation)))
+                    {
+                        state.current_best = context->best;
+                        state.current_best_internal = context->best_internal;
+                        state.best_evaluation = context->best_evaluation;
+                        state.optimum_found = state.optimum_found || context->best.y == objective_.y;
+                    }
+                    if (context->evaluation != 0 && (last == nullptr || context->evaluation > last->evaluation))
+                        last = context;
+                }
+                if (last != nullptr)
+                {
+                    state.current = last->current;
+                    state.current_internal = last->current_internal;
+                }
+            }
+
+            /**
+             * \brief Folds the results of concurrent evaluations into state_, after which either way of
+             * evaluating can continue from it.
+             */
+            void synchronize()
+            {
+                state_.unpack();
+                if (concurrency_.enabled)
+                    merge_concurrent_state(state_);
+                concurrency_.evaluations = state_.evaluations;
+                concurrency_.committed = state_.evaluations;
+                concurrency_.best_y = state_.current_best.y;
+            }
+
+            /**
+             * \brief Evaluates a solution on the context of the calling thread. The evaluation number is handed
+             * out atomically. Without a logger, the best-so-far solution is merged lock-free. With a logger, the
+             * evaluations are committed to the state and logged in the order of their evaluation numbers.
+             */
+            template <typename X>
+            double evaluate_concurrently(const X &x)
+            {
+                auto &context = thread_context();
+                const auto y = evaluate_solution(x, context.current, context.current_internal);
+                const auto evaluation = concurrency_.evaluations.fetch_add(1) + 1;
+                context.evaluation = evaluation;
+
+                if (logger_ != nullptr)
+                {
+                    while (concurrency_.committed.load(std::memory_order_acquire) != evaluation - 1)
+                        std::this_thread::yield();
+
+                    state_.store_best();
+                    state_.cancel_unpack();
+                    state_.current = context.current;
+                    state_.current_internal = context.current_internal;
+                    state_.update(meta_data_, objective_);
+                    update_log_info();
+                    logger_->log(log_info());
+                    concurrency_.committed.store(evaluation, std::memory_order_release);
+                    return y;
+                }
+
+                auto best = concurrency_.best_y.load();
+                while (common::compare_objectives(y, best, meta_data_.optimization_type))
+                {
+                    if (concurrency_.best_y.compare_exchange_weak(best, y))
+                    {
+                        context.best = context.current;
+                        context.best_internal = context.current_internal;
+                        context.best_evaluation = evaluation;
+                        break;
+                    }
+                }
+                return y;
+            }
+
         protected:
             MetaData meta_data_;
             Constraint<T> constraint_;
@@ -17,16 +196,17 @@ namespace ioh
             Solution<T> objective_;
             logger::Base *logger_{};
             logger::LogInfo log_info_;
+            Validation validation_;
 
             [[nodiscard]]
-            bool check_input_dimensions(const std::vector<T> &x)
+            bool check_input_dimensions(const size_t n)
             {
-                if (x.empty())
+                if (n == 0)
                 {
                     common::log::warning("The solution is empty.");
                     return false;
                 }
-                if (x.size() != static_cast<size_t>(meta_data_.n_variables))
+                if (n != static_cast<size_t>(meta_data_.n_variables))
                 {
                     common::log::warning("The dimension of solution is incorrect.");
                     return false;
@@ -34,28 +214,22 @@ namespace ioh
                 return true;
             }
 
-            template <typename Integer = T>
-            typename std::enable_if<std::is_integral<Integer>::value, bool>::type check_input(const std::vector<T> &x)
-            {
-                return check_input_dimensions(x);
-            }
-
-            template <typename Floating = T>
-            typename std::enable_if<std::is_floating_point<Floating>::value, bool>::type check_input(
-                const std::vector<T> &x)
+            /**
+             * \brief Checks that all values of a solution are finite, and warns about the first kind of invalid
+             * value which is found otherwise.
+             */
+            [[nodiscard]]
+            bool check_input_values(const T *x, const size_t n)
             {
-                if (!check_input_dimensions(x))
-                    return false;
-
-                if (common::all_finite(x))
+                if (common::all_finite(x, n))
                     return true;
 
-                if (common::has_nan(x))
+                if (common::has_nan(x, n))
                 {
                     common::log::warning("The solution contains NaN.");
                     return false;
                 }
-                if (common::has_inf(x))
+                if (common::has_inf(x, n))
                 {
                     common::log::warning("The solution contains Inf.");
                     return false;
@@ -64,6 +238,264 @@ namespace ioh
                 return false;
             }
 
+            //! Checks that all values of a solution are within the bounds of the constraint
+            [[nodiscard]]
+            bool check_input_bounds(const T *x, const size_t n)
+            {
+                if (constraint_.check(x, n))
+                    return true;
+
+                common::log::warning("The solution is out of bounds.");
+                return false;
+            }
+
+            /**
+             * \brief Checks a solution according to a validation policy. Only the checks required by the policy
+             * are compiled in, so Validation::None reduces to nothing.
+             * \tparam V the validation policy
+             * \param x pointer to the first element of the solution
+             * \param n the number of elements of the solution
+             * \return true if the solution can be evaluated
+             */
+            template <Validation V>
+            [[nodiscard]]
+            bool check_input(const T *x, const size_t n)
+            {
+                if constexpr (V == Validation::None)
+                    return true;
+                else
+                {
+                    if (!check_input_dimensions(n))
+                        return false;
+
+                    if constexpr (V != Validation::Dimension && std::is_floating_point<T>::value)
+                        if (!check_input_values(x, n))
+                            return false;
+
+                    if constexpr (V == Validation::Full)
+                        return check_input_bounds(x, n);
+                    else
+                        return true;
+                }
+            }
+
+            //! Checks that a parent has the right dimension, and that the flipped bits are in range
+            [[nodiscard]]
+            bool check_flips(const Parent<T> &parent, const std::vector<size_t> &flipped)
+            {
+                if (!check_input_dimensions(parent.solution.x.size()) ||
+                    parent.internal.x.size() != parent.solution.x.size())
+                    return false;
+                for (const auto i : flipped)
+                    if (i >= parent.solution.x.size())
+                    {
+                        common::log::warning("The flipped bit is out of range.");
+                        return false;
+                    }
+                return true;
+            }
+
+            /**
+             * \brief Checks a solution according to the validation policy of the problem. The policy selects one
+             * of the instantiations of check_input, which are all inlined here, so no checks are made for
+             * Validation::None.
+             */
+            [[nodiscard]]
+            bool check_input(const T *x, const size_t n)
+            {
+                switch (validation_)
+                {
+                case Validation::None:
+                    return check_input<Validation::None>(x, n);
+                case Validation::Dimension:
+                    return check_input<Validation::Dimension>(x, n);
+                case Validation::Finite:
+                    return check_input<Validation::Finite>(x, n);
+                default:
+                    return check_input<Validation::Full>(x, n);
+                }
+            }
+
+            /**
+             * \brief Checks a block of solutions of the right dimension in a single pass. When this fails, each of
+             * the solutions has to be checked individually by check_input.
+             * \param x pointer to the first element of the block
+             * \param n_samples the number of solutions in the block
+             * \return true if all solutions in the block are valid
+             */
+            [[nodiscard]]
+            bool check_batch(const T *x, const size_t n_samples)
+            {
+                const auto n = static_cast<size_t>(meta_data_.n_variables);
+                if constexpr (std::is_floating_point<T>::value)
+                    if ((validation_ == Validation::Finite || validation_ == Validation::Full) &&
+                        !common::all_finite(x, n_samples * n))
+                        return false;
+
+                if (validation_ == Validation::Full)
+                    for (size_t i = 0; i < n_samples; ++i)
+                        if (!constraint_.check(x + i * n, n))
+                            return false;
+                return true;
+            }
+
+            //! Marks a solution as the one which is being evaluated by the calling thread, see current()
+            struct EvaluationScope
+            {
+                const Solution<T> *previous;
+
+                explicit EvaluationScope(const Solution<T> &solution) :
+                    previous(std::exchange(evaluating(), &solution))
+                {
+                }
+
+                EvaluationScope(const EvaluationScope &) = delete;
+
+                EvaluationScope &operator=(const EvaluationScope &) = delete;
+
+                ~EvaluationScope() { evaluating() = previous; }
+            };
+
+            //! A solution which is given by the bits in which it differs from a parent, see evaluate_flips
+            struct Flips
+            {
+                const Parent<T> &parent;
+                const std::vector<size_t> &flipped;
+            };
+
+            /**
+             * \brief Transforms and evaluates a single solution, without touching the state of the problem.
+             * The buffers of the given solutions are reused, so no memory is allocated when x is transformed in
+             * place.
+             * \param x pointer to the first of meta_data_.n_variables elements
+             * \param current receives the solution and its objective value
+             * \param current_internal receives the internal representation of the solution and its value
+             * \return the objective value of x
+             */
+            double evaluate_solution(const T *x, Solution<T> &current, Solution<T> &current_internal)
+            {
+                const EvaluationScope scope(current);
+                const auto n = static_cast<size_t>(meta_data_.n_variables);
+                current.x.assign(x, x + n);
+                current_internal.x.assign(x, x + n);
+                current_internal.x = transform_variables(std::move(current_internal.x));
+                current_internal.y = evaluate(current_internal.x);
+                current.y = transform_objectives(current_internal.y);
+                return current.y;
+            }
+
+            /**
+             * \brief Transforms and evaluates a packed solution in its packed form, by transform_bits and
+             * evaluate_bits, without touching the state of the problem. The variables of the given solutions are
+             * left as they are.
+             * \param x the packed solution
+             * \param internal receives the packed internal representation of the solution
+             * \param current receives the objective value
+             * \param current_internal receives the value of the internal representation
+             * \return the objective value of x
+             */
+            double evaluate_packed(const common::BitString &x, common::BitString &internal, Solution<T> &current,
+                                   Solution<T> &current_internal)
+            {
+                const EvaluationScope scope(current);
+                internal = x;
+                transform_bits(internal);
+                current_internal.y = evaluate_bits(internal);
+                current.y = transform_objectives(current_internal.y);
+                return current.y;
+            }
+
+            /**
+             * \brief Transforms and evaluates a packed solution, without touching the state of the problem, see
+             * evaluate_packed. The solution and its internal representation are unpacked into the given solutions.
+             * \param x the packed solution
+             * \param current receives the solution and its objective value
+             * \param current_internal receives the internal representation of the solution and its value
+             * \return the objective value of x
+             */
+            double evaluate_solution(const common::BitString &x, Solution<T> &current, Solution<T> &current_internal)
+            {
+                thread_local common::BitString internal;
+
+                x.unpack(current.x);
+                evaluate_packed(x, internal, current, current_internal);
+                internal.unpack(current_internal.x);
+                return current.y;
+            }
+
+            /**
+             * \brief Flips bits of a parent and evaluates the result incrementally, by evaluate_flipped, without
+             * touching the state of the problem
+             * \param parent the parent
+             * \param flipped the distinct indices of the flipped bits
+             * \param current receives the solution and its objective value
+             * \param current_internal receives the internal representation of the solution and its value
+             * \param data receives the problem specific data of the solution
+             * \return the objective value of the solution
+             */
+            double flip_and_evaluate(const Parent<T> &parent, const std::vector<size_t> &flipped,
+                                     Solution<T> &current, Solution<T> &current_internal, std::vector<double> &data)
+            {
+                const EvaluationScope scope(current);
+                current.x = parent.solution.x;
+                for (const auto i : flipped)
+                    current.x[i] = static_cast<T>(current.x[i] == 0);
+                current_internal.x = parent.internal.x;
+                data = parent.data;
+                current_internal.y = evaluate_flipped(parent, flipped, current.x, current_internal.x, data);
+                current.y = transform_objectives(current_internal.y);
+                return current.y;
+            }
+
+            double evaluate_solution(const Flips &x, Solution<T> &current, Solution<T> &current_internal)
+            {
+                thread_local std::vector<double> data;
+                return flip_and_evaluate(x.parent, x.flipped, current, current_internal, data);
+            }
+
+            /**
+             * \brief Runs the evaluation pipeline for a single solution, without checking its validity. A packed
+             * solution is only unpacked into the state when the state or a logger needs its variables.
+             * \param x pointer to the first of meta_data_.n_variables elements, a packed solution or the flips of
+             * a parent
+             * \return the objective value of x
+             */
+            template <typename X>
+            double evaluate_unchecked(const X &x)
+            {
+                if (concurrency_.enabled)
+                    return evaluate_concurrently(x);
+
+                state_.store_best();
+                if constexpr (std::is_same<X, common::BitString>::value)
+                    evaluate_packed(x, state_.defer_unpack(x), state_.current, state_.current_internal);
+                else
+                {
+                    state_.cancel_unpack();
+                    evaluate_solution(x, state_.current, state_.current_internal);
+                }
+                state_.update(meta_data_, objective_);
+                if (logger_ != nullptr)
+                {
+                    state_.unpack();
+                    update_log_info();
+                    logger_->log(log_info());
+                }
+                return state_.current.y;
+            }
+
+            /**
+             * \brief The solution which is being evaluated by the calling thread. Since a problem can be evaluated
+             * concurrently, this should be used instead of state_.current during an evaluation. While a packed
+             * solution is evaluated, its variables are not unpacked into it.
+             */
+            [[nodiscard]]
+            const Solution<T> &current() const
+            {
+                const auto *solution = evaluating();
+                return solution != nullptr ? *solution : state_.current;
+            }
+
             [[nodiscard]]
             virtual double evaluate(const std::vector<T> &x) = 0;
 
@@ -80,10 +512,64 @@ namespace ioh
                 return y;
             }
 
+            /**
+             * \brief Transforms a packed solution in place, like transform_variables. Problems of bits can override
+             * this with a word-level transformation, the default goes through transform_variables.
+             */
+            virtual void transform_bits(common::BitString &x)
+            {
+                auto &unpacked = common::thread_local_buffer<T, common::BitString>(x.size());
+                x.unpack(unpacked.data());
+                unpacked = transform_variables(std::move(unpacked));
+                x.assign(unpacked.data(), unpacked.size());
+            }
+
+            /**
+             * \brief Evaluates a transformed packed solution, like evaluate. Problems of bits can override this with
+             * a word-level implementation, the default unpacks x and calls evaluate.
+             */
+            [[nodiscard]]
+            virtual double evaluate_bits(const common::BitString &x)
+            {
+                auto &unpacked = common::thread_local_buffer<T, common::BitString, 1>(x.size());
+                x.unpack(unpacked.data());
+                return evaluate(unpacked);
+            }
+
+            /**
+             * \brief Computes the problem specific data of a new parent, of which the solution and its internal
+             * representation have been evaluated. The default keeps no data.
+             */
+            virtual void initialize_parent(Parent<T> & /* parent */)
+            {
+            }
+
+            /**
+             * \brief Transforms and evaluates a solution which differs from a parent in a few flipped bits. Problems
+             * of bits can override this with an incremental evaluation, which only looks at the flipped bits, the
+             * default transforms and evaluates the solution from scratch.
+             * \param parent the parent
+             * \param flipped the distinct indices of the bits of the parent which are flipped
+             * \param x the solution, i.e. the parent with the bits flipped
+             * \param internal receives the internal representation of x, it holds that of the parent on entry
+             * \param data receives the problem specific data of x, it holds that of the parent on entry
+             * \return the raw objective value of x
+             */
+            [[nodiscard]]
+            virtual double evaluate_flipped(const Parent<T> & /* parent */, const std::vector<size_t> & /* flipped */,
+                                            const std::vector<T> &x, std::vector<T> &internal,
+                                            std::vector<double> & /* data */)
+            {
+                internal.assign(x.begin(), x.end());
+                internal = transform_variables(std::move(internal));
+                return evaluate(internal);
+            }
+
         public:
-            explicit Problem(MetaData meta_data, Constraint<T> constraint, Solution<T> objective) :
+            explicit Problem(MetaData meta_data, Constraint<T> constraint, Solution<T> objective,
+                             const Validation validation = Validation::Finite) :
                 meta_data_(std::move(meta_data)), constraint_(std::move(constraint)),
-                objective_(std::move(objective))
+                objective_(std::move(objective)), validation_(validation)
             {
                 state_ = State<T>({std::vector<T>(meta_data_.n_variables, std::numeric_limits<T>::signaling_NaN()),
                                 meta_data_.initial_objective_value});
@@ -94,22 +580,80 @@ namespace ioh
                 log_info_.current = state_.current.as_double();
             }
 
-            explicit Problem(MetaData meta_data, Constraint<T> constraint = Constraint<T>()):
+            explicit Problem(MetaData meta_data, Constraint<T> constraint = Constraint<T>(),
+                             const Validation validation = Validation::Finite):
                 Problem(meta_data, constraint, {
                             std::vector<T>(meta_data.n_variables, std::numeric_limits<T>::signaling_NaN()),
                             meta_data.optimization_type == common::OptimizationType::Minimization
                             ? -std::numeric_limits<double>::infinity()
                             : std::numeric_limits<double>::infinity()
-                        })
+                        }, validation)
             {
             }
 
+            /**
+             * \brief Copies the definition of a problem, i.e. its meta data, constraint, objective and settings.
+             * The copy starts from a fresh state, without a logger, and shares the immutable instance data which
+             * derived problems hold by reference.
+             */
+            Problem(const Problem &other) :
+                meta_data_(other.meta_data_), constraint_(other.constraint_), state_(other.state_),
+                objective_(other.objective_), log_info_(other.log_info_), validation_(other.validation_)
+            {
+                state_.reset();
+                concurrency_.enabled = other.concurrency_.enabled;
+            }
+
+            /**
+             * \brief Assigns the definition of a problem, like the copy constructor. The logger, if any, is
+             * detached, and the problem continues from a fresh state.
+             */
+            Problem &operator=(const Problem &other)
+            {
+                if (this == &other)
+                    return *this;
+
+                detach_logger();
+                meta_data_ = other.meta_data_;
+                constraint_ = other.constraint_;
+                state_ = other.state_;
+                objective_ = other.objective_;
+                log_info_ = other.log_info_;
+                validation_ = other.validation_;
+
+                state_.reset();
+                for (auto *context = concurrency_.contexts.load(); context != nullptr; context = context->next)
+                    context->evaluation = context->best_evaluation = 0;
+                concurrency_.enabled = other.concurrency_.enabled;
+                concurrency_.evaluations = state_.evaluations;
+                concurrency_.committed = state_.evaluations;
+                concurrency_.best_y = state_.current_best.y;
+                return *this;
+            }
+
             virtual ~Problem() = default;
 
+            /**
+             * \brief Creates a new instance of the same problem, which is meant to be used by another worker.
+             * Immutable per-instance data, such as rotation matrices, is shared with this problem, so cloning
+             * is much cheaper than creating the problem through the factory. The clone starts from a fresh state
+             * and has no logger attached.
+             * \return a new problem, or nullptr when the problem does not support cloning
+             */
+            [[nodiscard]]
+            virtual std::unique_ptr<Problem<T>> clone() const
+            {
+                common::log::warning("Problem " + meta_data_.name + " cannot be cloned.");
+                return nullptr;
+            }
+
 
             virtual void reset()
             {
                 state_.reset();
+                for (auto *context = concurrency_.contexts.load(); context != nullptr; context = context->next)
+                    context->evaluation = context->best_evaluation = 0;
+                synchronize();
                 if (logger_ != nullptr)
                     logger_->track_problem(meta_data_);
             }
@@ -123,7 +667,8 @@ namespace ioh
                 log_info_.y_best = state_.current_best_internal.y;
                 log_info_.transformed_y = state_.current.y;
                 log_info_.transformed_y_best = state_.current_best.y;
-                log_info_.current = state_.current.as_double();
+                log_info_.current.x.assign(state_.current.x.begin(), state_.current.x.end());
+                log_info_.current.y = state_.current.y;
             }
 
             [[nodiscard]]
@@ -134,33 +679,224 @@ namespace ioh
 
             void attach_logger(logger::Base &logger)
             {
+                synchronize();
                 logger_ = &logger;
                 logger_->track_problem(meta_data_);
             }
 
             void detach_logger()
             {
+                synchronize();
                 if (logger_ != nullptr)
                     logger_->flush();
                 logger_ = nullptr;
             }
 
+            /**
+             * \brief Sets the validation policy, which determines how each solution is checked before it is
+             * evaluated. With Validation::None, passing a solution of the wrong dimension is undefined behaviour.
+             * \param validation the validation policy
+             */
+            void set_validation(const Validation validation) { validation_ = validation; }
+
+            [[nodiscard]]
+            Validation validation() const
+            {
+                return validation_;
+            }
+
             double operator()(const std::vector<T> &x)
             {
-                if (!check_input(x))
+                if (!check_input(x.data(), x.size()))
                     return std::numeric_limits<double>::signaling_NaN();
+                return evaluate_unchecked(x.data());
+            }
 
-                state_.current.x = x;
-                state_.current_internal.x = transform_variables(x);
-                state_.current_internal.y = evaluate(state_.current_internal.x);
-                state_.current.y = transform_objectives(state_.current_internal.y);
-                state_.update(meta_data_, objective_);
-                if (logger_ != nullptr)
+            /**
+             * \brief Evaluates a solution stored in contiguous memory, such as a raw (aligned) array or a column
+             * of a matrix, without copying it into a std::vector first.
+             * \param x pointer to the first element of the solution
+             * \param n the number of elements of the solution
+             * \return the objective value of x
+             */
+            double operator()(const T *x, const size_t n)
+            {
+                if (!check_input(x, n))
+                    return std::numeric_limits<double>::signaling_NaN();
+                return evaluate_unchecked(x);
+            }
+
+            /**
+             * \brief Evaluates a solution with a validation policy which is fixed at compile time, regardless of
+             * validation(). Only the checks required by the policy are compiled in, so with Validation::None the
+             * solution goes straight into the evaluation.
+             * \tparam V the validation policy
+             * \param x pointer to the first element of the solution
+             * \param n the number of elements of the solution
+             * \return the objective value of x
+             */
+            template <Validation V>
+            double evaluate_with(const T *x, const size_t n)
+            {
+                if (!check_input<V>(x, n))
+                    return std::numeric_limits<double>::signaling_NaN();
+                return evaluate_unchecked(x);
+            }
+
+            //! Evaluates a solution with a validation policy which is fixed at compile time, see evaluate_with
+            template <Validation V>
+            double evaluate_with(const std::vector<T> &x)
+            {
+                return evaluate_with<V>(x.data(), x.size());
+            }
+
+            /**
+             * \brief Evaluates a solution held by any contiguous view or container which provides data() and
+             * size(), such as std::span, std::array or an Eigen vector.
+             * \param x the solution
+             * \return the objective value of x
+             */
+            template <typename View, typename = typename std::enable_if<std::is_same<
+                          typename std::remove_cv<typename std::remove_pointer<decltype(
+                              std::data(std::declval<const View &>()))>::type>::type, T>::value>::type>
+            double operator()(const View &x)
+            {
+                return (*this)(std::data(x), static_cast<size_t>(std::size(x)));
+            }
+
+            /**
+             * \brief Evaluates a packed solution of a problem of bits. It is counted and logged exactly like its
+             * unpacked form, but problems which override transform_bits and evaluate_bits never unpack it for the
+             * evaluation itself.
+             * \param x the solution
+             * \return the objective value of x
+             */
+            double operator()(const common::BitString &x)
+            {
+                static_assert(std::is_integral<T>::value, "Only problems of integers can evaluate bit strings");
+                if (validation_ != Validation::None && !check_input_dimensions(x.size()))
+                    return std::numeric_limits<double>::signaling_NaN();
+                return evaluate_unchecked(x);
+            }
+
+            /**
+             * \brief Evaluates a solution of a problem of bits as a parent, from which the solutions that differ
+             * from it in a few bits can be evaluated by evaluate_flips. This is not counted as an evaluation, the
+             * parent is usually a solution which has already been evaluated.
+             * \param x the solution
+             * \return the parent
+             */
+            [[nodiscard]]
+            Parent<T> make_parent(const std::vector<T> &x)
+            {
+                static_assert(std::is_integral<T>::value, "Only problems of integers can flip bits");
+                Parent<T> parent;
+                if (!check_input(x.data(), x.size()))
                 {
-                    update_log_info();
-                    logger_->log(log_info());
+                    parent.solution.x = x;
+                    return parent;
                 }
-                return state_.current.y;
+                evaluate_solution(x.data(), parent.solution, parent.internal);
+                initialize_parent(parent);
+                return parent;
+            }
+
+            /**
+             * \brief Evaluates the solution which is obtained by flipping a few bits of a parent. It is counted and
+             * logged exactly like evaluating that solution with operator(), but problems which override
+             * evaluate_flipped only look at the flipped bits, instead of evaluating the whole solution.
+             * \param parent a parent created by make_parent of this problem
+             * \param flipped the distinct indices of the flipped bits
+             * \return the objective value of the solution
+             */
+            double evaluate_flips(const Parent<T> &parent, const std::vector<size_t> &flipped)
+            {
+                static_assert(std::is_integral<T>::value, "Only problems of integers can flip bits");
+                if (validation_ != Validation::None && !check_flips(parent, flipped))
+                    return std::numeric_limits<double>::signaling_NaN();
+                return evaluate_unchecked(Flips{parent, flipped});
+            }
+
+            /**
+             * \brief Flips a few bits of a parent, and updates what was computed for it incrementally, such that it
+             * becomes the parent of the resulting solution. This is not counted as an evaluation.
+             * \param parent a parent created by make_parent of this problem
+             * \param flipped the distinct indices of the flipped bits
+             */
+            void apply_flips(Parent<T> &parent, const std::vector<size_t> &flipped)
+            {
+                static_assert(std::is_integral<T>::value, "Only problems of integers can flip bits");
+                if (validation_ != Validation::None && !check_flips(parent, flipped))
+                    return;
+                thread_local Parent<T> child;
+                flip_and_evaluate(parent, flipped, child.solution, child.internal, child.data);
+                std::swap(parent, child);
+            }
+
+            /**
+             * \brief Evaluates all solutions which differ from a parent in a single bit, as local search does. Each
+             * of them is counted and logged like a call to evaluate_flips, in the order of the flipped bit, so for
+             * problems with an incremental evaluation this takes much less than n full evaluations.
+             * \param parent a parent created by make_parent of this problem
+             * \param y pointer to an array of n_variables elements, element i receives the objective value of the
+             * parent with bit i flipped
+             */
+            void evaluate_neighbors(const Parent<T> &parent, double *y)
+            {
+                static_assert(std::is_integral<T>::value, "Only problems of integers can flip bits");
+                const auto n = static_cast<size_t>(meta_data_.n_variables);
+                std::vector<size_t> flipped;
+                if (validation_ != Validation::None && !check_flips(parent, flipped))
+                {
+                    std::fill(y, y + n, std::numeric_limits<double>::signaling_NaN());
+                    return;
+                }
+                flipped.resize(1);
+                for (size_t i = 0; i < n; ++i)
+                {
+                    flipped[0] = i;
+                    y[i] = evaluate_unchecked(Flips{parent, flipped});
+                }
+            }
+
+            /**
+             * \brief Evaluates a batch of solutions, stored contiguously in row-major order. Every solution is
+             * counted and logged exactly as if it was passed to operator() on its own, in order, but the input
+             * is validated once for the whole block and the buffers of the problem are reused between rows.
+             * \param x pointer to the first element of a block of n_samples x n_variables elements, whose size the
+             * caller has to guarantee
+             * \param n_samples the number of solutions in the block
+             * \param y pointer to an array of n_samples elements, which receives the objective values
+             */
+            void evaluate_batch(const T *x, const size_t n_samples, double *y)
+            {
+                const auto n = static_cast<size_t>(meta_data_.n_variables);
+                if (n_samples == 0)
+                    return;
+
+                const auto valid = check_batch(x, n_samples);
+                for (size_t i = 0; i < n_samples; ++i, x += n)
+                    y[i] = valid || check_input(x, n)
+                               ? evaluate_unchecked(x)
+                               : std::numeric_limits<double>::signaling_NaN();
+            }
+
+            /**
+             * \brief Evaluates a batch of solutions, stored contiguously in row-major order.
+             * \param x a vector of n_samples x n_variables elements
+             * \return a vector containing the n_samples objective values
+             */
+            std::vector<double> evaluate_batch(const std::vector<T> &x)
+            {
+                const auto n = static_cast<size_t>(meta_data_.n_variables);
+                if (n == 0 || x.size() % n != 0)
+                {
+                    common::log::warning("The size of the batch is not a multiple of the dimension.");
+                    return {};
+                }
+                std::vector<double> y(x.size() / n);
+                evaluate_batch(x.data(), y.size(), y.data());
+                return y;
             }
 
             [[nodiscard]]
@@ -178,9 +914,43 @@ namespace ioh
             [[nodiscard]]
             State<T> state() const
             {
-                return state_;
+                auto state = state_;
+                if (concurrency_.enabled)
+                    merge_concurrent_state(state);
+                state.materialize();
+                return state;
+            }
+
+            /**
+             * \brief Sets the way in which the best-so-far solution is tracked. With Tracking::Lightweight, an
+             * improvement costs no copies of the solution, while the best-so-far solution is still available
+             * through state().
+             * \param tracking the tracking mode
+             */
+            void set_tracking(const Tracking tracking)
+            {
+                state_.materialize();
+                state_.tracking = tracking;
+            }
+
+            /**
+             * \brief Enables or disables concurrent evaluation. When enabled, the problem can be called from
+             * multiple threads at the same time. Each thread evaluates on its own solution buffers, the
+             * evaluations are counted atomically and the best-so-far solution is merged lock-free. When a logger
+             * is attached, the evaluations are logged in the order of their evaluation numbers. Switching the
+             * mode, attaching or detaching a logger, resetting and calling state() require that no evaluations
+             * are running.
+             * \param concurrent whether to allow concurrent evaluations
+             */
+            void set_concurrent(const bool concurrent)
+            {
+                synchronize();
+                concurrency_.enabled = concurrent;
             }
 
+            //! Whether concurrent evaluations are enabled
+            [[nodiscard]] bool concurrent() const { return concurrency_.enabled; }
+
             [[nodiscard]]
             Constraint<T> constraint() const
             {
@@ -232,6 +1002,12 @@ namespace ioh
                 function_(f)
             {
             }
+
+            [[nodiscard]]
+            std::unique_ptr<Problem<T>> clone() const override
+            {
+                return std::make_unique<WrappedProblem<T>>(*this);
+            }
         };
 
         template <typename T>
@@ -255,12 +1031,24 @@ namespace ioh
         {
         public:
             using Real::Real;
+
+            [[nodiscard]]
+            std::unique_ptr<Real> clone() const override
+            {
+                return std::make_unique<ProblemType>(static_cast<const ProblemType &>(*this));
+            }
         };
 
         template <typename ProblemType>
         struct IntegerProblem : Integer, AutomaticProblemRegistration<ProblemType, Integer>
         {
             using Integer::Integer;
+
+            [[nodiscard]]
+            std::unique_ptr<Integer> clone() const override
+            {
+                return std::make_unique<ProblemType>(static_cast<const ProblemType &>(*this));
+            }
         };
     }
 }
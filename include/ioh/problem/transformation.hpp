@@ -50,6 +50,19 @@ namespace ioh::problem::transformation
 
         using Transformation = std::function<double(double, double)>;
 
+        /**
+         * \brief The random number which is drawn by uniform, which only depends on the seed, so that it can be
+         * computed once per instance
+         * \param seed the seed for the uniform random number generator
+         * \param lb the lower bound for the random number
+         * \param ub the upper bound for the random number
+         * \return the random number
+         */
+        inline double uniform_scalar(const int seed, const double lb, const double ub)
+        {
+            return common::random::uniform(1, seed, lb, ub).at(0);
+        }
+
         /**
          * \brief applies a given transformation method t(double y, double a) with a random number for a.
          * \param t A transformation method
@@ -61,7 +74,7 @@ namespace ioh::problem::transformation
          */
         inline double uniform(const Transformation &t, const double y, const int seed, const double lb, const double ub)
         {
-            const auto scalar = common::random::uniform(1, seed, lb, ub).at(0);
+            const auto scalar = uniform_scalar(seed, lb, ub);
             return t(y, scalar);
         }
 
@@ -99,7 +112,7 @@ namespace ioh::problem::transformation
          * \return the penalized y value
          */
         template <typename T>
-        double penalize(const std::vector<double> &x, const Constraint<T> constraint, const double factor,
+        double penalize(const std::vector<double> &x, const Constraint<T> &constraint, const double factor,
                         const double y)
         {
             return penalize(x, static_cast<double>(constraint.lb.at(0)), static_cast<double>(constraint.ub.at(0)),
@@ -110,63 +123,201 @@ namespace ioh::problem::transformation
     namespace variables
     {
         /**
-         * \brief randomly flips a bit 
-         * \param x raw variables
+         * \brief The bits which random_flip flips, which only depend on the seed
+         * \param n the number of variables
          * \param seed seed for the random flip
+         * \return a mask of n bits
          */
-        inline void random_flip(std::vector<int> &x, const int seed)
+        inline std::vector<int> random_flip_mask(const size_t n, const int seed)
         {
-            const auto n = static_cast<int>(x.size());
             const auto rx = common::random::uniform(n, seed);
+            std::vector<int> mask(n);
+            for (size_t i = 0; i < n; ++i)
+                mask[i] = static_cast<int>(2.0 * floor(1e4 * rx.at(i)) / 1e4);
+            return mask;
+        }
 
-            for (auto i = 0; i < n; ++i)
-                x[i] = objective::exclusive_or(x.at(i), static_cast<int>(2.0 * floor(1e4 * rx.at(i)) / 1e4));
+        /**
+         * \brief flips the bits of x for which the mask is set
+         * \param x raw variables
+         * \param mask the mask, as computed by random_flip_mask
+         */
+        inline void random_flip(std::vector<int> &x, const std::vector<int> &mask)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] = objective::exclusive_or(x[i], mask[i]);
         }
 
         /**
-         * \brief randomly reorder the elements from x
+         * \brief randomly flips a bit 
          * \param x raw variables
          * \param seed seed for the random flip
          */
-        inline void random_reorder(std::vector<int> &x, const int seed)
+        inline void random_flip(std::vector<int> &x, const int seed)
         {
-            std::vector<int> index(x.size());
+            random_flip(x, random_flip_mask(x.size(), seed));
+        }
+
+        /**
+         * \brief The order in which random_reorder puts the elements of x, which only depends on the seed
+         * \param n the number of variables
+         * \param seed seed for the random reordering
+         * \return the index of the element which ends up at each position
+         */
+        inline std::vector<int> random_reorder_index(const size_t n, const int seed)
+        {
+            std::vector<int> index(n);
             std::iota(index.begin(), index.end(), 0);
 
-            const auto n = static_cast<int>(x.size());
             const auto rx = common::random::uniform(n, seed);
-            const auto copy_x = x;
-
-            for (auto i = 0; i != n; ++i)
+            for (size_t i = 0; i != n; ++i)
             {
-                const auto t = static_cast<int>(floor(rx.at(i) * n));
+                const auto t = static_cast<int>(floor(rx.at(i) * static_cast<double>(n)));
                 const auto temp = index[0];
                 index[0] = index[t];
                 index[t] = temp;
             }
-            for (auto i = 0; i < n; ++i)
-                x[i] = copy_x.at(index[i]);
+            return index;
         }
 
+        /**
+         * \brief reorders the elements from x, which does not allocate memory when the capacity of buffer suffices
+         * \param x raw variables
+         * \param index the order, as computed by random_reorder_index
+         * \param buffer work space, which is swapped with x after the reordering
+         */
+        inline void random_reorder(std::vector<int> &x, const std::vector<int> &index, std::vector<int> &buffer)
+        {
+            buffer.resize(x.size());
+            for (size_t i = 0; i < x.size(); ++i)
+                buffer[i] = x[index[i]];
+            x.swap(buffer);
+        }
 
         /**
-         * \brief Affine transformation for x using matrix M and vector B
+         * \brief randomly reorder the elements from x
+         * \param x raw variables
+         * \param seed seed for the random flip
+         */
+        inline void random_reorder(std::vector<int> &x, const int seed)
+        {
+            std::vector<int> buffer;
+            random_reorder(x, random_reorder_index(x.size(), seed), buffer);
+        }
+
+
+        /**
+         * \brief Affine transformation for x using matrix M and vector B, which does not allocate memory
+         * when the capacity of buffer suffices
          * \param x raw variables
          * \param m transformation matrix
          * \param b transformation vector
+         * \param buffer work space, which is swapped with x after the transformation
          */
         inline void affine(std::vector<double> &x, const std::vector<std::vector<double>> &m,
-                           const std::vector<double> &b)
+                           const std::vector<double> &b, std::vector<double> &buffer)
         {
-            auto temp_x = x;
+            buffer.resize(x.size());
             for (size_t i = 0; i < x.size(); ++i)
             {
-                x[i] = b[i];
+                buffer[i] = b[i];
                 for (size_t j = 0; j < x.size(); ++j)
-                    x[i] += temp_x[j] * m[i][j];
+                    buffer[i] += x[j] * m[i][j];
             }
+            x.swap(buffer);
         }
 
+        /**
+         * \brief Affine transformation for x using matrix M and vector B
+         * \param x raw variables
+         * \param m transformation matrix
+         * \param b transformation vector
+         */
+        inline void affine(std::vector<double> &x, const std::vector<std::vector<double>> &m,
+                           const std::vector<double> &b)
+        {
+            std::vector<double> buffer(x.size());
+            affine(x, m, b, buffer);
+        }
+
+        /**
+         * \brief Affine transformation for x using matrix M and vector B, fused with an element-wise operation,
+         * which does not allocate memory when the capacity of buffer suffices. The product is computed by the
+         * vectorized kernel for the instruction set of the processor, see common::simd::affine.
+         * \param x raw variables
+         * \param m transformation matrix, with contiguous rows
+         * \param b transformation vector
+         * \param buffer work space, which is swapped with x after the transformation
+         * \param op element-wise operation op(i, xi), such as Oscillate, applied to the transformed variables
+         */
+        template <typename Op = common::simd::Identity>
+        void affine(std::vector<double> &x, const common::Matrix<double> &m, const std::vector<double> &b,
+                    std::vector<double> &buffer, const Op &op = {})
+        {
+            buffer.resize(x.size());
+            common::simd::affine(m.data(), m.stride(), b.data(), x.data(), buffer.data(), x.size(), x.size(), op);
+            x.swap(buffer);
+        }
+
+        /**
+         * \brief Linear transformation for x using matrix M, i.e. an affine transformation with a zero vector,
+         * fused with an element-wise operation
+         * \param x raw variables
+         * \param m transformation matrix, with contiguous rows
+         * \param buffer work space, which is swapped with x after the transformation
+         * \param op element-wise operation op(i, xi), applied to the transformed variables
+         */
+        template <typename Op = common::simd::Identity>
+        void linear(std::vector<double> &x, const common::Matrix<double> &m, std::vector<double> &buffer,
+                    const Op &op = {})
+        {
+            buffer.resize(x.size());
+            common::simd::affine(m.data(), m.stride(), nullptr, x.data(), buffer.data(), x.size(), x.size(), op);
+            x.swap(buffer);
+        }
+
+        /**
+         * \brief Affine transformation for x using matrix M and vector B
+         * \param x raw variables
+         * \param m transformation matrix, with contiguous rows
+         * \param b transformation vector
+         */
+        inline void affine(std::vector<double> &x, const common::Matrix<double> &m, const std::vector<double> &b)
+        {
+            std::vector<double> buffer(x.size());
+            affine(x, m, b, buffer);
+        }
+
+        /**
+         * \brief Element-wise form of the asymmetric transformation, which can be fused with affine
+         */
+        struct Asymmetric
+        {
+            double beta;
+            double n_eff;
+
+            /**
+             * \param beta scale of the transformation
+             * \param n the number of variables
+             */
+            Asymmetric(const double beta, const size_t n) : beta(beta), n_eff(static_cast<double>(n) - 1.0) {}
+
+            double operator()(const size_t i, const double xi) const
+            {
+                return xi > 0.0 ? pow(xi, 1.0 + beta * static_cast<double>(i) / n_eff * sqrt(xi)) : xi;
+            }
+        };
+
+        /**
+         * \brief Element-wise form of the oscillation, which can be fused with affine
+         */
+        struct Oscillate
+        {
+            double alpha = 0.1;
+
+            double operator()(size_t, const double xi) const { return objective::oscillate(xi, alpha); }
+        };
+
         /**
          * \brief Asymmetric transformation scaled by beta
          * \param x raw variables
@@ -174,13 +325,39 @@ namespace ioh::problem::transformation
          */
         inline void asymmetric(std::vector<double> &x, const double beta)
         {
-            const auto n_eff = static_cast<double>(x.size()) - 1.0;
-            for (auto i = 0; i < static_cast<int>(x.size()); ++i)
-                if (x[i] > 0.0)
-                    x[i] = pow(x[i], 1.0 + beta * i / n_eff * sqrt(x[i]));
+            const Asymmetric op(beta, x.size());
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] = op(i, x[i]);
         }
 
 
+        /**
+         * \brief The coefficients beta * i / (n - 1) of the asymmetric transformation, which only depend on the
+         * dimension
+         * \param n the number of variables
+         * \param beta scale of the transformation
+         */
+        inline std::vector<double> asymmetric_coefficients(const size_t n, const double beta)
+        {
+            const auto n_eff = static_cast<double>(n) - 1.0;
+            std::vector<double> coefficients(n);
+            for (size_t i = 0; i < n; ++i)
+                coefficients[i] = beta * static_cast<double>(i) / n_eff;
+            return coefficients;
+        }
+
+        /**
+         * \brief Asymmetric transformation with precomputed coefficients
+         * \param x raw variables
+         * \param coefficients the coefficients, as computed by asymmetric_coefficients
+         */
+        inline void asymmetric(std::vector<double> &x, const std::vector<double> &coefficients)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+                if (x[i] > 0.0)
+                    x[i] = pow(x[i], 1.0 + coefficients[i] * sqrt(x[i]));
+        }
+
         /**
          * \brief brs transformation on x
          * \param x raw variables
@@ -197,6 +374,30 @@ namespace ioh::problem::transformation
             }
         }
 
+        /**
+         * \brief The factors sqrt(10)^(i / (n - 1)) of the brs transformation, which only depend on the dimension
+         * \param n the number of variables
+         */
+        inline std::vector<double> brs_factors(const size_t n)
+        {
+            const auto n_eff = static_cast<double>(n) - 1.0;
+            std::vector<double> factors(n);
+            for (size_t i = 0; i < n; ++i)
+                factors[i] = pow(sqrt(10.0), static_cast<double>(i) / n_eff);
+            return factors;
+        }
+
+        /**
+         * \brief brs transformation on x with precomputed factors
+         * \param x raw variables
+         * \param factors the factors, as computed by brs_factors
+         */
+        inline void brs(std::vector<double> &x, const std::vector<double> &factors)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] = (x[i] > 0.0 && i % 2 == 0 ? factors[i] * 10.0 : factors[i]) * x[i];
+        }
+
         /**
          * \brief conditioning transformation of x
          * \param x raw variables
@@ -209,6 +410,32 @@ namespace ioh::problem::transformation
                 x[i] = pow(alpha, 0.5 * i / n_eff) * x[i];
         }
 
+        /**
+         * \brief The factors alpha^(0.5 * i / (n - 1)) of the conditioning transformation, which only depend on
+         * the dimension
+         * \param n the number of variables
+         * \param alpha base of the transformation
+         */
+        inline std::vector<double> conditioning_factors(const size_t n, const double alpha)
+        {
+            const auto n_eff = static_cast<double>(n) - 1.0;
+            std::vector<double> factors(n);
+            for (size_t i = 0; i < n; ++i)
+                factors[i] = pow(alpha, 0.5 * static_cast<double>(i) / n_eff);
+            return factors;
+        }
+
+        /**
+         * \brief conditioning transformation of x with precomputed factors
+         * \param x raw variables
+         * \param factors the factors, as computed by conditioning_factors
+         */
+        inline void conditioning(std::vector<double> &x, const std::vector<double> &factors)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] = factors[i] * x[i];
+        }
+
         /**
          * \brief oscillate each variable in x
          * \param x raw variables
@@ -243,6 +470,31 @@ namespace ioh::problem::transformation
                 x[i] = x[i] - offset[i];
         }
 
+        /**
+         * \brief The signs which random_sign_flip applies, which only depend on the seed
+         * \param n the number of variables
+         * \param seed for generating the random vector
+         * \return -1 for each variable of which the sign is reversed, and 1 otherwise
+         */
+        inline std::vector<double> random_signs(const size_t n, const long seed)
+        {
+            auto signs = common::random::bbob2009::uniform(n, seed);
+            for (auto &sign : signs)
+                sign = sign < 0.5 ? -1.0 : 1.0;
+            return signs;
+        }
+
+        /**
+         * \brief multiply each xi by its sign, which is a branch-free way of reversing the signs
+         * \param x raw variables
+         * \param signs the signs, as computed by random_signs
+         */
+        inline void random_sign_flip(std::vector<double> &x, const std::vector<double> &signs)
+        {
+            for (size_t i = 0; i < x.size(); ++i)
+                x[i] = signs[i] * x[i];
+        }
+
         /**
          * \brief randomly reverse the sign for each xi
          * \param x raw variables
@@ -250,10 +502,7 @@ namespace ioh::problem::transformation
          */
         inline void random_sign_flip(std::vector<double> &x, const long seed)
         {
-            const auto random_numbers = common::random::bbob2009::uniform(x.size(), seed);
-            for (size_t i = 0; i < x.size(); ++i)
-                if (random_numbers[i] < 0.5)
-                    x[i] = -x[i];
+            random_sign_flip(x, random_signs(x.size(), seed));
         }
 
         /**
@@ -263,9 +512,119 @@ namespace ioh::problem::transformation
          */
         inline void z_hat(std::vector<double> &x, const std::vector<double> &xopt)
         {
-            const auto temp_x = x;
-            for (size_t i = 1; i < x.size(); ++i)
-                x[i] = temp_x[i] + 0.25 * (temp_x[i - 1] - 2.0 * fabs(xopt[i - 1]));
+            for (auto i = x.size(); i-- > 1;)
+                x[i] = x[i] + 0.25 * (x[i - 1] - 2.0 * fabs(xopt[i - 1]));
         }
     }
+
+    /**
+     * \brief The transformation of an instance of a pseudo-Boolean problem, which is computed once per instance.
+     * Instances 2 to 50 flip a random subset of the bits, instances 51 to 100 reorder them, and the objective value
+     * of every instance above 1 is scaled and shifted by random scalars.
+     */
+    struct PseudoBooleanTransformation
+    {
+        int instance;
+
+        //! The bits which are flipped in instances 2 to 50
+        std::vector<int> flip_mask{};
+
+        //! flip_mask as a bit string, for the packed solutions
+        common::BitString packed_flip_mask{};
+
+        //! The order of the variables in instances 51 to 100
+        std::vector<int> reorder_index{};
+
+        //! The inverse of reorder_index, the position to which each variable is moved
+        std::vector<size_t> reorder_position{};
+
+        //! The factor by which the objective value is scaled in instances above 1
+        double objective_scale = 1.0;
+
+        //! The offset by which the objective value is shifted in instances above 1
+        double objective_shift = 0.0;
+
+        /**
+         * \param instance the instance of the problem
+         * \param n_variables the dimension of the problem
+         * \param scale_lb the lower bound of the scale of the objective value
+         * \param scale_ub the upper bound of the scale of the objective value
+         * \param shift_lb the lower bound of the shift of the objective value
+         * \param shift_ub the upper bound of the shift of the objective value
+         */
+        PseudoBooleanTransformation(const int instance, const int n_variables, const double scale_lb,
+                                    const double scale_ub, const double shift_lb, const double shift_ub) :
+            instance(instance)
+        {
+            const auto n = static_cast<size_t>(n_variables);
+            if (instance > 1 && instance <= 50)
+            {
+                flip_mask = variables::random_flip_mask(n, instance);
+                packed_flip_mask = common::BitString(flip_mask);
+            }
+            else if (instance > 50 && instance <= 100)
+            {
+                reorder_index = variables::random_reorder_index(n, instance);
+                reorder_position.resize(reorder_index.size());
+                for (size_t i = 0; i < reorder_index.size(); ++i)
+                    reorder_position[static_cast<size_t>(reorder_index[i])] = i;
+            }
+
+            if (instance > 1)
+            {
+                objective_scale = objective::uniform_scalar(instance, scale_lb, scale_ub);
+                objective_shift = objective::uniform_scalar(instance, shift_lb, shift_ub);
+            }
+        }
+
+        //! Flips or reorders the variables of a solution
+        void transform_variables(std::vector<int> &x) const
+        {
+            if (!flip_mask.empty())
+                variables::random_flip(x, flip_mask);
+            else if (!reorder_index.empty())
+                variables::random_reorder(x, reorder_index,
+                                          common::thread_local_buffer<int, PseudoBooleanTransformation>(x.size()));
+        }
+
+        //! Flips or reorders the bits of a packed solution
+        void transform_bits(common::BitString &x) const
+        {
+            if (!flip_mask.empty())
+                x ^= packed_flip_mask;
+            else if (!reorder_index.empty())
+            {
+                thread_local common::BitString reordered;
+                x.permute(reorder_index, reordered);
+                std::swap(x, reordered);
+            }
+        }
+
+        /**
+         * \brief The positions in the transformed solution of a few flipped variables. Both transformations move
+         * a flipped variable to a flipped bit of the transformed solution.
+         * \param flipped the distinct indices of the flipped variables
+         * \return flipped itself, or the positions in a buffer which is private to the calling thread
+         */
+        [[nodiscard]]
+        const std::vector<size_t> &transform_flips(const std::vector<size_t> &flipped) const
+        {
+            if (reorder_position.empty())
+                return flipped;
+
+            auto &positions = common::thread_local_buffer<size_t, PseudoBooleanTransformation>(flipped.size());
+            for (size_t i = 0; i < flipped.size(); ++i)
+                positions[i] = reorder_position[flipped[i]];
+            return positions;
+        }
+
+        //! Scales and shifts the objective value in instances above 1
+        [[nodiscard]]
+        double transform_objectives(const double y) const
+        {
+            if (instance > 1)
+                return objective::shift(objective::scale(y, objective_scale), objective_shift);
+            return y;
+        }
+    };
 }
@@ -26,6 +26,50 @@ namespace ioh
             }
         };
 
+        /**
+         * \brief A solution of a problem of bits together with what its evaluation computed, from which the
+         * solutions that differ from it in a few flipped bits are evaluated incrementally, see
+         * Problem::evaluate_flips. It is created by Problem::make_parent, and only valid for the problem which
+         * created it.
+         */
+        template <typename T>
+        struct Parent
+        {
+            //! The solution and its objective value
+            Solution<T> solution;
+            //! The internal representation of the solution and its raw objective value
+            Solution<T> internal;
+            //! Problem specific data of the internal solution, such as partial sums, which the problem keeps up to date
+            std::vector<double> data;
+        };
+
+        /**
+         * \brief The amount of validation which is performed on a solution before it is evaluated
+         */
+        enum class Validation
+        {
+            //! No validation at all, the caller guarantees that each solution has the right dimension
+            None,
+            //! Only the dimension of a solution is checked
+            Dimension,
+            //! The dimension is checked, and that all values of a solution are finite, which is the default
+            Finite,
+            //! Like Finite, and additionally that all values of a solution are within the bounds of the constraint
+            Full
+        };
+
+        /**
+         * \brief The way in which a State keeps track of the best-so-far solution
+         */
+        enum class Tracking
+        {
+            //! Both best-so-far solutions are copied on every improvement
+            Full,
+            //! Only the objective values are stored on an improvement, the best-so-far variables are kept by
+            //! swapping buffers before they are overwritten, and copied only when they are requested
+            Lightweight
+        };
+
         template <typename T>
         struct Constraint
         {
@@ -57,14 +101,32 @@ namespace ioh
                     std::cout << "Bound dimension is wrong" << std::endl;
             }
 
-            bool check(const std::vector<T> &x)
+            /**
+             * \brief Checks whether x has the dimension of the bounds and each of its elements is within them. A
+             * problem checks this before each evaluation under Validation::Full only, since problems such as BBOB
+             * define their own behaviour outside of the bounds.
+             * \param x pointer to the first element of x
+             * \param n the number of elements of x
+             * \return true if x satisfies the constraint
+             */
+            [[nodiscard]]
+            bool check(const T *x, const size_t n) const
             {
-                for (size_t i = 0; i < x.size(); i++)
-                    if (!(lb.at(i) >= x.at(i) && x.at(i) <= lb.at(i)))
+                if (n != ub.size() || n != lb.size())
+                    return false;
+
+                for (size_t i = 0; i < n; i++)
+                    if (!(lb[i] <= x[i] && x[i] <= ub[i]))
                         return false;
                 return true;
             }
 
+            [[nodiscard]]
+            bool check(const std::vector<T> &x) const
+            {
+                return check(x.data(), x.size());
+            }
+
             friend std::ostream &operator<<(std::ostream &os, const Constraint &obj)
             {
                 os << "[ ";
@@ -126,9 +188,17 @@ namespace ioh
         {
         private:
             Solution<T> initial_solution;
+            bool best_pending_ = false;
+
+            //! The packed current solution and its internal representation, which are not unpacked yet
+            common::BitString packed_, packed_internal_;
+            bool unpack_pending_ = false;
         public:
             int evaluations = 0;
             bool optimum_found = false;
+            //! The number of the evaluation at which the best-so-far solution was found
+            int best_evaluation = 0;
+            Tracking tracking = Tracking::Full;
             Solution<T> current_best_internal;
             Solution<T> current_best;
 
@@ -140,12 +210,16 @@ namespace ioh
             State(Solution<T> initial) :
                 initial_solution(std::move(initial))
             {
+                current_internal.x.reserve(initial_solution.x.size());
+                current.x.reserve(initial_solution.x.size());
                 reset();
             }
 
             void reset()
             {
                 evaluations = 0;
+                best_evaluation = 0;
+                best_pending_ = false;
                 current_best = initial_solution;
                 current_best_internal = initial_solution;
                 optimum_found = false;
@@ -156,14 +230,86 @@ namespace ioh
                 ++evaluations;
                 if (common::compare_objectives(current.y, current_best.y, meta_data.optimization_type))
                 {
-                    current_best_internal = current_internal;
-                    current_best = current;
+                    unpack();
+                    best_evaluation = evaluations;
+                    if (tracking == Tracking::Full)
+                    {
+                        current_best_internal = current_internal;
+                        current_best = current;
+                    }
+                    else
+                    {
+                        current_best_internal.y = current_internal.y;
+                        current_best.y = current.y;
+                        best_pending_ = true;
+                    }
 
                     if (objective.y == current.y)
                         optimum_found = true;
                 }
             }
 
+            /**
+             * \brief With lightweight tracking, hands the variables of the current solution over to the best-so-far
+             * solution when the current solution is the best one. This swaps buffers, and must be called before
+             * the current solution is overwritten.
+             */
+            void store_best()
+            {
+                if (best_pending_)
+                {
+                    current_best_internal.x.swap(current_internal.x);
+                    current_best.x.swap(current.x);
+                    best_pending_ = false;
+                }
+            }
+
+            /**
+             * \brief Records the variables of the current solution in packed form, instead of unpacking them into
+             * current.x and current_internal.x. They are unpacked by unpack, which update calls on an improvement.
+             * \param x the packed current solution
+             * \return the buffer which receives the packed internal representation of the current solution
+             */
+            common::BitString &defer_unpack(const common::BitString &x)
+            {
+                packed_ = x;
+                unpack_pending_ = true;
+                return packed_internal_;
+            }
+
+            //! Discards the packed form of the current solution, before its variables are written directly
+            void cancel_unpack()
+            {
+                unpack_pending_ = false;
+            }
+
+            //! Unpacks the variables of the current solution, if they have been recorded in packed form
+            void unpack()
+            {
+                if (unpack_pending_)
+                {
+                    packed_.unpack(current.x);
+                    packed_internal_.unpack(current_internal.x);
+                    unpack_pending_ = false;
+                }
+            }
+
+            /**
+             * \brief Unpacks the variables of the current solution, and with lightweight tracking, copies them to
+             * the best-so-far solution when the current solution is the best one, such that all fields of the
+             * state are valid.
+             */
+            void materialize()
+            {
+                unpack();
+                if (best_pending_)
+                {
+                    current_best_internal.x = current_internal.x;
+                    current_best.x = current.x;
+                    best_pending_ = false;
+                }
+            }
+
             friend std::ostream &operator<<(std::ostream &os, const State &obj)
             {
                 return os
@@ -204,12 +350,19 @@ namespace ioh
                 return {position.begin(), position.begin() + select_num};
             }
 
-            static std::vector<int> neutrality(const std::vector<int> &x, const int mu)
+            /**
+             * \brief Neutrality transformation of x, written into new_variables
+             * \param x the variables
+             * \param mu the size of the blocks which are reduced to a single variable
+             * \param new_variables the output, which is cleared first. When its capacity suffices, no memory is
+             * allocated.
+             */
+            static void neutrality(const std::vector<int> &x, const int mu, std::vector<int> &new_variables)
             {
                 const auto n_variables = static_cast<int>(x.size());
                 const auto n = static_cast<int>(floor(static_cast<double>(n_variables) / static_cast<double>(mu)));
                 
-                std::vector<int> new_variables;
+                new_variables.clear();
                 new_variables.reserve(n);
                 
                 auto cum_sum = 0;
@@ -226,15 +379,28 @@ namespace ioh
                         cum_sum = 0;
                     }
                 }
+            }
+
+            //! Neutrality transformation of x, see neutrality(x, mu, new_variables)
+            inline std::vector<int> neutrality(const std::vector<int> &x, const int mu)
+            {
+                std::vector<int> new_variables;
+                neutrality(x, mu, new_variables);
                 return new_variables;
             }
 
-            static std::vector<int> epistasis(const std::vector<int> &variables,
-                                              int v)
+            /**
+             * \brief Epistasis transformation of variables, written into new_variables
+             * \param variables the variables
+             * \param v the size of the epistatic blocks
+             * \param new_variables the output, which is cleared first. When its capacity suffices, no memory is
+             * allocated.
+             */
+            static void epistasis(const std::vector<int> &variables, int v, std::vector<int> &new_variables)
             {
                 int epistasis_result;
                 const auto number_of_variables = static_cast<int>(variables.size());
-                std::vector<int> new_variables;
+                new_variables.clear();
                 new_variables.reserve(number_of_variables);
                 auto h = 0;
                 while (h + v - 1 < number_of_variables)
@@ -289,6 +455,13 @@ namespace ioh
                         ++i;
                     }
                 }
+            }
+
+            //! Epistasis transformation of variables, see epistasis(variables, v, new_variables)
+            inline std::vector<int> epistasis(const std::vector<int> &variables, const int v)
+            {
+                std::vector<int> new_variables;
+                epistasis(variables, v, new_variables);
                 return new_variables;
             }
 
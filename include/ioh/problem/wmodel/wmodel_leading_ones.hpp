@@ -21,5 +21,11 @@ namespace ioh::problem::wmodel
                    ruggedness_para)
         {
         }
+
+        [[nodiscard]]
+        std::unique_ptr<Integer> clone() const override
+        {
+            return std::make_unique<WModelLeadingOnes>(*this);
+        }
     };
 }
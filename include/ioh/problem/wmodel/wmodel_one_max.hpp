@@ -20,5 +20,11 @@ namespace ioh::problem::wmodel
         {
             
         }
+
+        [[nodiscard]]
+        std::unique_ptr<Integer> clone() const override
+        {
+            return std::make_unique<WModelOneMax>(*this);
+        }
     };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ioh/problem/problem.hpp"
+#include "ioh/problem/transformation.hpp"
 #include "ioh/problem/utils.hpp"
 
 namespace ioh::problem
@@ -15,21 +16,20 @@ namespace ioh::problem
         int ruggedness_gamma_ = 0;
         std::vector<int> ruggedness_info_;
 
+        //! The transformation of the instance
+        transformation::PseudoBooleanTransformation instance_transformation_;
+
         std::vector<int> transform_variables(std::vector<int> x) override
         {
-            if (meta_data_.instance > 1 && meta_data_.instance <= 50)
-                transformation::variables::random_flip(x, meta_data_.instance);
-            else if (meta_data_.instance > 50 && meta_data_.instance <= 100)
-                transformation::variables::random_reorder(x, meta_data_.instance);
+            instance_transformation_.transform_variables(x);
             return x;
         }
 
+        void transform_bits(common::BitString &x) override { instance_transformation_.transform_bits(x); }
+
         double transform_objectives(const double y) override
         {
-            using namespace transformation::objective;
-            if (meta_data_.instance > 1)
-                return uniform(shift, uniform(scale, y, meta_data_.instance, -0.2, 4.8), meta_data_.instance, 1e3, 2e3);
-            return y;
+            return instance_transformation_.transform_objectives(y);
         }
 
         double evaluate(const std::vector<int> &x) override
@@ -68,7 +68,8 @@ namespace ioh::problem
                const int ruggedness_gamma) :
             Integer(MetaData(problem_id, instance, name, n_variables, common::OptimizationType::Maximization)),
             dummy_select_rate_(dummy_select_rate), epistasis_block_size_(epistasis_block_size),
-            neutrality_mu_(neutrality_mu), ruggedness_gamma_(ruggedness_gamma * n_variables)
+            neutrality_mu_(neutrality_mu), ruggedness_gamma_(ruggedness_gamma * n_variables),
+            instance_transformation_(instance, n_variables, -0.2, 4.8, 1e3, 2e3)
         {
             auto temp_dimension = n_variables;
 
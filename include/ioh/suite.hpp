@@ -241,6 +241,16 @@ namespace ioh::suite
         }
     };
 
+    struct LargeScaleBBOB final : RealSuite<LargeScaleBBOB>
+    {
+        LargeScaleBBOB(const std::vector<int> &problem_ids, const std::vector<int> &instances,
+                       const std::vector<int> &dimensions) :
+            RealSuite(problem_ids, instances, dimensions, "LargeScaleBBOB", 100, 10000,
+                      reinterpret_cast<Factory &>(problem::ProblemFactoryType<problem::LargeScaleBBOB>::instance()))
+        {
+        }
+    };
+
     struct PBO final : IntegerSuite<PBO>
     {
         PBO(const std::vector<int> &problem_ids, const std::vector<int> &instances,
@@ -1,4 +1,5 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include <pybind11/functional.h>
 #include "ioh.hpp"
@@ -38,6 +39,8 @@ void define_state(py::module &m, const std::string &name)
         .def_readonly("evaluations", &Class::evaluations, "The number of times the problem has been evaluated so far.")
         .def_readonly("optimum_found", &Class::optimum_found,
                       "Boolean indicating whether or not the optimum has been found.")
+        .def_readonly("best_evaluation", &Class::best_evaluation,
+                      "The number of the evaluation at which the best so far solution was found.")
         .def_readonly("current_best_internal", &Class::current_best_internal,
                       "The internal representation of the best so far solution.")
         .def_readonly("current_best", &Class::current_best, "The current best-so-far solution.")
@@ -58,7 +61,7 @@ void define_constraint(py::module &m, const std::string &name)
         .def(py::init<std::vector<T>, std::vector<T>>())
         .def_readonly("ub", &Class::ub, "The upper bound (box constraint)")
         .def_readonly("lb", &Class::lb, "The lower bound (box constraint)")
-        .def("check", &Class::check,
+        .def("check", py::overload_cast<const std::vector<T> &>(&Class::check, py::const_),
              R"pbdoc(
             Check if a point is inside the bounds or not.
 
@@ -181,7 +184,38 @@ void define_base_class(py::module &m, const std::string &name)
             ----------
                 logger: A logger-object from the IOHexperimenter 'logger' module.
         )pbdoc")
-        .def("__call__", &ProblemType::operator(),
+        .def("__call__", [](ProblemType &p, const py::buffer &buffer) -> py::object
+             {
+                 // Only objects that support the buffer protocol end up here, so lists never require numpy
+                 const auto x = py::array_t<T, py::array::c_style | py::array::forcecast>::ensure(buffer);
+                 if (!x)
+                     throw py::type_error("x cannot be interpreted as an array");
+                 if (x.ndim() == 1)
+                     return py::float_(p(x.data(), static_cast<size_t>(x.shape(0))));
+                 if (x.ndim() != 2)
+                     throw py::value_error("x should be a 1 or 2-dimensional array");
+
+                 const auto n_samples = static_cast<size_t>(x.shape(0));
+                 const auto n = static_cast<size_t>(x.shape(1));
+                 py::array_t<double> y(x.shape(0));
+                 if (n == static_cast<size_t>(p.meta_data().n_variables))
+                     p.evaluate_batch(x.data(), n_samples, y.mutable_data());
+                 else
+                     for (size_t i = 0; i < n_samples; ++i)
+                         y.mutable_at(i) = p(x.data(i, 0), n);
+                 return y;
+             },
+             py::arg("x"),
+             R"pbdoc(
+            Evaluate the problem on a numpy array (or any other object supporting the buffer protocol),
+            directly on its memory when it is C-contiguous and of the right type.
+
+            Parameters
+            ----------
+                x: a 1-dimensional array of size equal to the dimension of this problem, or a 2-dimensional
+                   array with a solution on each row. For the latter, an array with the value of each row is returned.
+        )pbdoc")
+        .def("__call__", py::overload_cast<const std::vector<T> &>(&ProblemType::operator()),
              R"pbdoc(
             Evaluate the problem.
 
@@ -189,6 +223,20 @@ void define_base_class(py::module &m, const std::string &name)
             ----------
                 x: a 1-dimensional array / list of size equal to the dimension of this problem
         )pbdoc")
+        .def("clone", [](const ProblemType &self) { return std::shared_ptr<ProblemType>(self.clone()); },
+             R"pbdoc(
+            Create a new instance of this problem, with a fresh state and without a logger attached.
+            Immutable instance data, such as rotation matrices, is shared with this problem.
+        )pbdoc")
+        .def("set_tracking", &ProblemType::set_tracking,
+             R"pbdoc(
+            Set the way in which the best so far solution is tracked.
+
+            Parameters
+            ----------
+                tracking: Tracking.Full copies the best so far solution on every improvement (default),
+                          Tracking.Lightweight only copies it when the state is requested.
+        )pbdoc")
         .def_static("factory", &Factory::instance, py::return_value_policy::reference,
                     "A factory method to get the relevant problem. Recommended is to use the 'get_problem'-function instead.")
         .def_property_readonly("log_info", &ProblemType::log_info, "Check what data is being sent to the logger.")
@@ -231,6 +279,11 @@ void define_helper_classes(py::module &m)
         .value("Minimization", ioh::common::OptimizationType::Minimization)
         .export_values();
 
+    py::enum_<ioh::problem::Tracking>(m, "Tracking")
+        .value("Full", ioh::problem::Tracking::Full)
+        .value("Lightweight", ioh::problem::Tracking::Lightweight)
+        .export_values();
+
     define_solution<double>(m, "RealSolution");
     define_solution<int>(m, "IntegerSolution");
     define_constraint<int>(m, "IntegerConstraint");
@@ -408,7 +461,16 @@ void define_bbob_problems(py::module &m)
 
         )pbdoc"
             )
-        .def_static("factory", &ioh::common::Factory<BBOB, int, int>::instance, py::return_value_policy::reference);
+        .def_static("factory", &ioh::common::Factory<BBOB, int, int>::instance, py::return_value_policy::reference)
+        .def_static(
+            "enable_instance_cache",
+            [](const std::string &directory) { bbob::InstanceCache::enable(directory); },
+            py::arg("directory"),
+            R"pbdoc(
+            Store the rotation matrices of every BBOB instance that is created in a file in directory,
+            and read them back when the same instance is created again, e.g. by another process.
+            )pbdoc")
+        .def_static("disable_instance_cache", &bbob::InstanceCache::disable);
     py::class_<bbob::Sphere, Real, std::shared_ptr<bbob::Sphere>>(m, "Sphere", py::is_final())
         .def(py::init<int, int>());
     py::class_<bbob::Ellipsoid, Real, std::shared_ptr<bbob::Ellipsoid>>(m, "Ellipsoid", py::is_final())
@@ -467,6 +529,32 @@ void define_bbob_problems(py::module &m)
         .def(py::init<int, int>());
 }
 
+void define_large_scale_bbob_problems(py::module &m)
+{
+    define_factory<LargeScaleBBOB>(m, "LargeScaleBBOBFactory");
+    py::class_<LargeScaleBBOB, Real, std::shared_ptr<LargeScaleBBOB>>(
+            m, "LargeScaleBBOB",
+            R"pbdoc(
+            The large-scale variant of the 24 BBOB functions, in which the dense rotation matrices
+            are replaced by permuted block-diagonal rotations with blocks of size min(40, n).
+            Constructing and evaluating a problem costs O(n * b) time and memory, for blocks of
+            size b, which makes dimensions in the thousands practical.
+
+            The problems are created by name through the factory, e.g.
+            LargeScaleBBOB.factory().create("LargeScaleSphere", 1, 1000).
+
+            Reference
+            ---------
+            [VarelasEtAl20] Konstantinos Varelas, Ouassim Ait El Hara, Dimo Brockhoff, Nikolaus Hansen,
+            Duc Manh Nguyen, Tea Tušar, and Anne Auger. "Benchmarking large-scale continuous optimizers:
+            The bbob-largescale testbed, a COCO software guide and beyond."
+            Applied Soft Computing 97 (2020).
+        )pbdoc"
+            )
+        .def_static("factory", &ioh::common::Factory<LargeScaleBBOB, int, int>::instance,
+                    py::return_value_policy::reference);
+}
+
 void define_problem_bases(py::module &m)
 {
     define_base_class<Real, double>(m, "Real");
@@ -479,5 +567,6 @@ void define_problem(py::module &m)
 {
     define_problem_bases(m);
     define_bbob_problems(m);
+    define_large_scale_bbob_problems(m);
     define_pbo_problems(m);
 }
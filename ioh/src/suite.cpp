@@ -73,6 +73,9 @@ void define_suite(py::module &m)
     py::class_<BBOB, Suite<ioh::problem::Real>, std::shared_ptr<BBOB>>(m, "BBOB")
         .def(py::init<std::vector<int>, std::vector<int>, std::vector<int>>());
 
+    py::class_<LargeScaleBBOB, Suite<ioh::problem::Real>, std::shared_ptr<LargeScaleBBOB>>(m, "LargeScaleBBOB")
+        .def(py::init<std::vector<int>, std::vector<int>, std::vector<int>>());
+
     define_base_class<Suite<ioh::problem::Integer>>(m, "IntegerBase");
 
     py::class_<Integer, Suite<ioh::problem::Integer>, std::shared_ptr<Integer>>(m, "Integer")
@@ -83,4 +83,256 @@ TEST(common, buffered_file) {
     EXPECT_EQ(f.buffer(), "");
     f.remove();
     EXPECT_FALSE(fs::exists(f.path()));
-}
\ No newline at end of file
+}
+
+TEST(common, matrix)
+{
+    using ioh::common::Matrix;
+    Matrix<double> m(3, 5, 1.0);
+    EXPECT_EQ(m.rows(), 3u);
+    EXPECT_EQ(m.cols(), 5u);
+    EXPECT_EQ(m.stride(), 8u);
+
+    for (size_t i = 0; i < m.rows(); ++i)
+    {
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(m.row(i)) % Matrix<double>::alignment, 0u);
+        for (size_t j = 0; j < m.stride(); ++j)
+            EXPECT_DOUBLE_EQ(m.row(i)[j], j < m.cols() ? 1.0 : 0.0);
+    }
+
+    m[1][2] = 4.0;
+    EXPECT_DOUBLE_EQ(m(1, 2), 4.0);
+
+    std::vector<double> x{1.0, 2.0, 3.0, 4.0, 5.0};
+    Matrix<double> identity(5, 5);
+    for (size_t i = 0; i < 5; ++i)
+        identity(i, i) = 2.0;
+    ioh::problem::transformation::variables::affine(x, identity, std::vector<double>(5, 1.0));
+    EXPECT_EQ(x, std::vector<double>({3.0, 5.0, 7.0, 9.0, 11.0}));
+}
+
+
+TEST(common, simd_affine)
+{
+    using namespace ioh::common::simd;
+    const auto detected = detect_instruction_set();
+
+    for (size_t n = 1; n <= 37; ++n)
+    {
+        ioh::common::Matrix<double> m(n, n);
+        const auto values = ioh::common::random::uniform(n * n, static_cast<long>(n), -1, 1);
+        for (size_t i = 0; i < n; ++i)
+            for (size_t j = 0; j < n; ++j)
+                m(i, j) = values[i * n + j];
+        const auto x = ioh::common::random::uniform(n, static_cast<long>(n) + 1, -5, 5);
+        const auto b = ioh::common::random::uniform(n, static_cast<long>(n) + 2, -5, 5);
+
+        std::vector<double> expected(n);
+        kernels::affine_scalar(m.data(), m.stride(), b.data(), x.data(), expected.data(), n, n);
+
+        for (const auto set : {InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512})
+        {
+            set_instruction_set(set);
+            std::vector<double> out(n);
+            affine(m.data(), m.stride(), b.data(), x.data(), out.data(), n, n);
+            for (size_t i = 0; i < n; ++i)
+                EXPECT_NEAR(out[i], expected[i], 1e-12) << "n = " << n << ", instruction set " << static_cast<int>(set);
+        }
+    }
+    set_instruction_set(detected);
+}
+
+
+TEST(common, simd_weighted_distances)
+{
+    using namespace ioh::common::simd;
+    const auto detected = detect_instruction_set();
+
+    for (size_t n = 1; n <= 37; ++n)
+    {
+        const size_t rows = 5;
+        ioh::common::Matrix<double> c(rows, n), w(rows, n);
+        const auto centers = ioh::common::random::uniform(rows * n, static_cast<long>(n), -5, 5);
+        const auto weights = ioh::common::random::uniform(rows * n, static_cast<long>(n) + 1, 0, 10);
+        for (size_t i = 0; i < rows; ++i)
+            for (size_t j = 0; j < n; ++j)
+            {
+                c(i, j) = centers[i * n + j];
+                w(i, j) = weights[i * n + j];
+            }
+        const auto x = ioh::common::random::uniform(n, static_cast<long>(n) + 2, -5, 5);
+
+        std::vector<double> expected(rows);
+        kernels::weighted_distances_scalar(c.data(), w.data(), c.stride(), x.data(), expected.data(), rows, n);
+
+        for (const auto set : {InstructionSet::SSE2, InstructionSet::AVX2, InstructionSet::AVX512})
+        {
+            set_instruction_set(set);
+            std::vector<double> out(rows);
+            weighted_distances(c.data(), w.data(), c.stride(), x.data(), out.data(), rows, n);
+            for (size_t i = 0; i < rows; ++i)
+                EXPECT_NEAR(out[i], expected[i], 1e-10) << "n = " << n << ", instruction set " << static_cast<int>(set);
+        }
+    }
+    set_instruction_set(detected);
+}
+
+
+TEST(common, fused_affine)
+{
+    using namespace ioh::problem::transformation::variables;
+    const size_t n = 13;
+    ioh::common::Matrix<double> m(n, n);
+    const auto values = ioh::common::random::uniform(n * n, 5, -1, 1);
+    for (size_t i = 0; i < n; ++i)
+        for (size_t j = 0; j < n; ++j)
+            m(i, j) = values[i * n + j];
+    const auto x = ioh::common::random::uniform(n, 6, -5, 5);
+    const auto xopt = ioh::common::random::uniform(n, 7, -4, 4);
+
+    auto expected = x;
+    subtract(expected, xopt);
+    affine(expected, m, std::vector<double>(n, 0.0));
+    oscillate(expected);
+    asymmetric(expected, 0.2);
+
+    std::vector<double> offset(n);
+    ioh::common::simd::affine(m.data(), m.stride(), nullptr, xopt.data(), offset.data(), n, n,
+                              [](size_t, const double value) { return -value; });
+    auto fused = x;
+    std::vector<double> buffer;
+    const Asymmetric asymmetry(0.2, n);
+    affine(fused, m, offset, buffer,
+           [&asymmetry](const size_t i, const double xi) { return asymmetry(i, Oscillate{}(i, xi)); });
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_NEAR(fused[i], expected[i], 1e-10);
+
+    auto at_optimum = xopt;
+    affine(at_optimum, m, offset, buffer);
+    EXPECT_EQ(at_optimum, std::vector<double>(n, 0.0));
+}
+
+
+TEST(common, precomputed_transformations)
+{
+    using namespace ioh::problem::transformation::variables;
+    const size_t n = 17;
+    const auto x = ioh::common::random::uniform(n, 11, -5, 5);
+
+    // Under -ffast-math the tables may be rounded differently from the direct expressions
+    const auto expect_equal = [n](const std::vector<double> &tabled, const std::vector<double> &expected) {
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_DOUBLE_EQ(tabled[i], expected[i]) << i;
+    };
+
+    auto expected = x, tabled = x;
+    conditioning(expected, 10.0);
+    conditioning(tabled, conditioning_factors(n, 10.0));
+    expect_equal(tabled, expected);
+
+    expected = tabled = x;
+    brs(expected);
+    brs(tabled, brs_factors(n));
+    expect_equal(tabled, expected);
+
+    expected = tabled = x;
+    asymmetric(expected, 0.2);
+    asymmetric(tabled, asymmetric_coefficients(n, 0.2));
+    expect_equal(tabled, expected);
+}
+
+TEST(common, cached_random_transformations)
+{
+    using namespace ioh::problem::transformation;
+    const size_t n = 17;
+    const auto x = ioh::common::random::uniform(n, 11, -5, 5);
+
+    auto flipped = x, expected = x;
+    const auto random_numbers = ioh::common::random::bbob2009::uniform(n, 3);
+    for (size_t i = 0; i < n; ++i)
+        if (random_numbers[i] < 0.5)
+            expected[i] = -expected[i];
+    variables::random_sign_flip(flipped, variables::random_signs(n, 3));
+    EXPECT_EQ(flipped, expected);
+
+    std::vector<int> bits(n), buffer;
+    for (size_t i = 0; i < n; ++i)
+        bits[i] = static_cast<int>(i % 3 == 0);
+
+    auto masked = bits, seeded = bits;
+    variables::random_flip(masked, variables::random_flip_mask(n, 5));
+    variables::random_flip(seeded, 5);
+    EXPECT_EQ(masked, seeded);
+
+    const auto index = variables::random_reorder_index(n, 5);
+    auto sorted = index;
+    std::sort(sorted.begin(), sorted.end());
+    for (size_t i = 0; i < n; ++i)
+        EXPECT_EQ(sorted[i], static_cast<int>(i));
+
+    auto reordered = bits;
+    seeded = bits;
+    variables::random_reorder(reordered, index, buffer);
+    variables::random_reorder(seeded, 5);
+    EXPECT_EQ(reordered, seeded);
+
+    EXPECT_EQ(objective::uniform(objective::shift, 1.0, 7, 0, 10),
+              objective::shift(1.0, objective::uniform_scalar(7, 0, 10)));
+}
+
+TEST(common, bit_string)
+{
+    using namespace ioh::common;
+
+    for (const auto n : {1, 63, 64, 65, 200})
+    {
+        std::vector<int> x(n);
+        for (auto i = 0; i < n; ++i)
+            x[i] = (i * 7 + 3) % 5 < 3;
+
+        BitString packed(x);
+        EXPECT_EQ(packed.size(), static_cast<size_t>(n));
+        EXPECT_EQ(packed.n_words(), static_cast<size_t>((n + 63) / 64));
+        EXPECT_EQ(packed.to_vector(), x);
+        EXPECT_EQ(packed.count(), static_cast<size_t>(std::count(x.begin(), x.end(), 1)));
+
+        std::fill(x.begin(), x.end(), 1);
+        packed.assign(x.data(), x.size());
+        EXPECT_EQ(packed.count(), static_cast<size_t>(n));
+        EXPECT_EQ(packed.leading_ones(), static_cast<size_t>(n));
+
+        packed.flip(n - 1);
+        EXPECT_FALSE(packed[n - 1]);
+        EXPECT_EQ(packed.leading_ones(), static_cast<size_t>(n - 1));
+        packed.set(n / 2, false);
+        EXPECT_EQ(packed.leading_ones(), static_cast<size_t>(n / 2));
+
+        std::vector<int> reverse(n);
+        for (auto i = 0; i < n; ++i)
+            reverse[i] = n - 1 - i;
+        BitString reordered;
+        packed.permute(reverse, reordered);
+        for (auto i = 0; i < n; ++i)
+            EXPECT_EQ(reordered[i], packed[n - 1 - i]);
+
+        reordered ^= reordered;
+        EXPECT_EQ(reordered, BitString(n));
+    }
+}
+
+TEST(common, autocorrelation)
+{
+    for (const auto n : {1, 2, 7, 64, 129, 1000})
+    {
+        const auto x = ioh::common::random::uniform(static_cast<size_t>(n), n, -3, 3);
+        std::vector<double> c(n);
+        ioh::common::Autocorrelation(static_cast<size_t>(n))(x.data(), c.data());
+        for (auto k = 0; k < n; ++k)
+        {
+            auto expected = 0.0;
+            for (auto i = 0; i + k < n; ++i)
+                expected += x[i] * x[i + k];
+            EXPECT_NEAR(c[k], expected, 1e-10 * n) << "n " << n << " k " << k;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <gtest/gtest.h>
+#include "ioh.hpp"
+
+namespace
+{
+    std::atomic<bool> count_allocations{false};
+    std::atomic<size_t> n_allocations{0};
+
+    template <typename T>
+    size_t allocations(ioh::problem::Problem<T> &problem, const std::vector<std::vector<T>> &samples)
+    {
+        // The first evaluation is allowed to size the buffers of the problem
+        problem(samples.front());
+
+        n_allocations = 0;
+        count_allocations = true;
+        for (const auto &x : samples)
+            problem(x);
+        count_allocations = false;
+        return n_allocations;
+    }
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+// Returning memory from malloc in operator new is the whole point of this replacement
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// The array, nothrow and sized variants of the global allocation functions all forward to these
+void *operator new(const std::size_t size)
+{
+    if (count_allocations)
+        ++n_allocations;
+    if (auto *ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+TEST(problems, allocation_free_real)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::Real>::instance();
+    const auto n_samples = 5, dimension = 16;
+
+    std::vector<std::vector<double>> samples;
+    for (auto i = 0; i < n_samples; ++i)
+        samples.push_back(ioh::common::random::uniform(dimension, 42 + i, -5, 5));
+
+    for (const auto &name : problem_factory.names())
+    {
+        const auto problem = problem_factory.create(name, 1, dimension);
+        EXPECT_EQ(allocations(*problem, samples), 0) << *problem;
+    }
+}
+
+TEST(problems, allocation_free_large_scale)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::LargeScaleBBOB>::instance();
+    const auto n_samples = 5, dimension = 100;
+
+    std::vector<std::vector<double>> samples;
+    for (auto i = 0; i < n_samples; ++i)
+        samples.push_back(ioh::common::random::uniform(dimension, 42 + i, -5, 5));
+
+    for (const auto &name : problem_factory.names())
+    {
+        const auto problem = problem_factory.create(name, 1, dimension);
+        EXPECT_EQ(allocations(*problem, samples), 0) << *problem;
+    }
+}
+
+TEST(problems, allocation_free_integer)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::Integer>::instance();
+    const auto n_samples = 5, dimension = 16;
+
+    std::vector<std::vector<int>> samples;
+    for (auto i = 0; i < n_samples; ++i)
+    {
+        std::vector<int> x;
+        for (const auto r : ioh::common::random::uniform(dimension, 42 + i))
+            x.push_back(r < 0.5 ? 0 : 1);
+        samples.push_back(x);
+    }
+
+    // Instance 1 is untransformed, 2 flips the bits and 51 reorders them
+    for (const auto instance : {1, 2, 51})
+        for (const auto &name : problem_factory.names())
+        {
+            const auto problem = problem_factory.create(name, instance, dimension);
+            EXPECT_EQ(allocations(*problem, samples), 0) << *problem;
+        }
+}
@@ -6,6 +6,49 @@
 
 #include "../utils.hpp"
 
+struct TransformationStateProbe : ioh::problem::BBOB
+{
+    using BBOB::TransformationState;
+};
+
+//! AttractiveSector, written against the interface of BBOB without a function
+class LegacyAttractiveSector final : public ioh::problem::BBOB
+{
+    std::vector<double> offset_;
+
+protected:
+    double evaluate(const std::vector<double> &x) override
+    {
+        return ioh::problem::bbob::kernels::attractive_sector(x.data(), x.size(), objective_.x.data());
+    }
+
+    std::vector<double> transform_variables(std::vector<double> x) override
+    {
+        ioh::problem::transformation::variables::affine(x, transformation_state_->second_transformation_matrix,
+                                                        offset_, transformation_buffer());
+        return x;
+    }
+
+    double transform_objectives(const double y) override
+    {
+        using namespace ioh::problem::transformation::objective;
+        return BBOB::transform_objectives(pow(oscillate(y), .9));
+    }
+
+public:
+    LegacyAttractiveSector(const int instance, const int n_variables) :
+        BBOB(6, instance, n_variables, "LegacyAttractiveSector"),
+        offset_(objective_offset(transformation_state_->second_transformation_matrix))
+    {
+    }
+
+    [[nodiscard]]
+    std::unique_ptr<ioh::problem::Real> clone() const override
+    {
+        return std::make_unique<LegacyAttractiveSector>(*this);
+    }
+};
+
 
 
 TEST(BBOBfitness, dimension5)
@@ -56,3 +99,188 @@ TEST(BBOBfitness, dimension20)
  ins_id << " ) is " << f << " ( not " << y << ").";
     }
 }
+
+TEST(BBOBfitness, second_transformation_matrix)
+{
+    for (const auto n : {2, 7, 40})
+    {
+        const TransformationStateProbe::TransformationState state(23, 2, n, 100.0);
+        for (auto i = 0; i < n; ++i)
+            for (auto j = 0; j < n; ++j)
+            {
+                auto expected = 0.0;
+                for (auto k = 0; k < n; ++k)
+                    expected += state.first_rotation[i][k] * pow(100.0, state.exponents.at(k))
+                        * state.second_rotation[k][j];
+                EXPECT_NEAR(state.second_transformation_matrix[i][j], expected, 1e-12);
+            }
+    }
+}
+
+TEST(BBOBfitness, pure_functions)
+{
+    using namespace ioh::problem;
+    const std::vector<bbob::Function> functions{
+        bbob::f1,  bbob::f2,  bbob::f3,  bbob::f4,  bbob::f5,  bbob::f6,  bbob::f7,  bbob::f8,
+        bbob::f9,  bbob::f10, bbob::f11, bbob::f12, bbob::f13, bbob::f14, bbob::f15, bbob::f16,
+        bbob::f17, bbob::f18, bbob::f19, bbob::f20, bbob::f21, bbob::f22, bbob::f23, bbob::f24};
+    const auto &problem_factory = ProblemRegistry<BBOB>::instance();
+    const auto n = 10;
+    const auto x = ioh::common::random::uniform(n, 3, -6, 6);
+
+    for (auto id = 1; id <= 24; ++id)
+    {
+        const auto problem = problem_factory.create(id, 2, n);
+        EXPECT_EQ(problem->function(), functions[id - 1]) << *problem;
+        const auto y = functions[id - 1](x.data(), x.size(), problem->params());
+        EXPECT_EQ((*problem)(x), y) << *problem;
+
+        const auto &stages = problem->stages();
+        const auto &internal = problem->state().current_internal;
+        EXPECT_EQ(stages.evaluate(internal.x.data(), x.size(), problem->params()), internal.y) << *problem;
+        if (stages.transform_objectives != nullptr)
+        {
+            EXPECT_EQ(stages.transform_objectives(internal.y, x.data(), x.size(), problem->params()), y) << *problem;
+        }
+        EXPECT_EQ(functions[id - 1](problem->objective().x.data(), x.size(), problem->params()),
+                  problem->objective().y) << *problem;
+    }
+
+    bbob::InstanceParams params(21, 2, n);
+    bbob::initialize_f21(params);
+    EXPECT_EQ(bbob::f21(x.data(), x.size(), params), (*problem_factory.create(21, 2, n))(x));
+}
+
+TEST(BBOBfitness, legacy_subclass)
+{
+    using namespace ioh::problem;
+    const auto n = 10;
+    const auto x = ioh::common::random::uniform(n, 3, -6, 6);
+    bbob::AttractiveSector problem(2, n);
+    LegacyAttractiveSector legacy(2, n);
+    EXPECT_EQ(legacy.function(), nullptr);
+
+    const auto y = problem(x);
+    EXPECT_EQ(legacy(x), y);
+    auto z = x;
+    transformation::variables::affine(z, legacy.params().state.second_transformation_matrix,
+                                      problem.params().offset);
+    EXPECT_EQ(legacy.state().current_internal.x, z);
+    EXPECT_EQ(legacy.state().current_internal.y,
+              bbob::kernels::attractive_sector(z.data(), z.size(), legacy.objective().x.data()));
+    EXPECT_EQ(problem.state().current_internal.x, legacy.state().current_internal.x);
+    EXPECT_EQ(problem.state().current_internal.y, legacy.state().current_internal.y);
+
+    const auto clone = legacy.clone();
+    EXPECT_EQ((*clone)(x), y);
+}
+
+TEST(BBOBfitness, katsuura_kernel)
+{
+    using namespace ioh::common::simd;
+    namespace kernels = ioh::problem::bbob::kernels;
+    const auto detected = detect_instruction_set();
+
+    for (const size_t n : {1, 3, 8, 13, 40, 1000})
+    {
+        const auto x = ioh::common::random::uniform(n, static_cast<long>(n), -5, 5);
+        const auto exponent = 10. / pow(static_cast<double>(n), 1.2);
+        const auto factor = 10. / static_cast<double>(n * n);
+
+        auto product = 1.0;
+        std::vector<double> expected_sums(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+            for (auto j = 1; j < 33; ++j)
+            {
+                const auto power = pow(2., static_cast<double>(j));
+                expected_sums[i] += fabs(power * x[i] - floor(power * x[i] + 0.5)) / power;
+            }
+            product *= pow(1.0 + (static_cast<double>(i) + 1) * expected_sums[i], exponent);
+        }
+        const auto expected = factor * (-1. + product);
+
+        for (const auto set : {InstructionSet::Scalar, InstructionSet::AVX2, InstructionSet::AVX512})
+        {
+            set_instruction_set(set);
+            std::vector<double> sums(n);
+            kernels::detail::katsuura_sums(x.data(), sums.data(), n);
+            EXPECT_EQ(sums, expected_sums) << "n = " << n << ", instruction set " << static_cast<int>(set);
+            EXPECT_NEAR(kernels::katsuura(x.data(), n, exponent, factor), expected, 1e-12 * fabs(expected))
+                << "n = " << n << ", instruction set " << static_cast<int>(set);
+        }
+    }
+    set_instruction_set(detected);
+}
+
+TEST(BBOBfitness, weierstrass_kernel)
+{
+    namespace constants = ioh::problem::bbob::kernels::weierstrass_constants;
+    static_assert(constants::f0 == -(2.0 - 1.0 / 2048.0));
+
+    for (const size_t n : {1, 2, 10, 40, 100, 1000})
+    {
+        for (const auto range : {0.5, 5.0, 50.0})
+        {
+            const auto x = ioh::common::random::uniform(n, static_cast<long>(n), -range, range);
+
+            auto sum = 0.0;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t k = 0; k < constants::n_harmonics; ++k)
+                    sum += cos(2 * IOH_PI * (x[i] + 0.5) * constants::frequencies[k]) * constants::amplitudes[k];
+            const auto r = sum / static_cast<double>(n) - constants::f0;
+            const auto expected = 10.0 * pow(r, 3.0);
+
+            // the rounding of the base angle, amplified by 3^k, and the bound of the recurrence, propagated
+            // through 10 * r^3
+            const auto bound = (range + 1.0) * 2.5e-12 * 30.0 * (r * r + 1.0);
+            EXPECT_NEAR(ioh::problem::bbob::kernels::weierstrass(x.data(), n), expected, bound)
+                << "n = " << n << ", range " << range;
+        }
+    }
+
+    const std::vector<double> zero(7, 0.0);
+    EXPECT_EQ(ioh::problem::bbob::kernels::weierstrass(zero.data(), zero.size()), 0.0);
+}
+
+TEST(BBOBfitness, instance_cache)
+{
+    using ioh::problem::bbob::InstanceCache;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::BBOB>::instance();
+    const auto directory = fs::temp_directory_path() / "ioh_instance_cache_test";
+    const auto dimension = 10;
+    const auto x = ioh::common::random::uniform(dimension, 5, -5, 5);
+    remove_all(directory);
+
+    std::vector<double> expected;
+    for (const auto &name : problem_factory.names())
+        expected.push_back((*problem_factory.create(name, 2, dimension))(x));
+
+    InstanceCache::enable(directory);
+    for (auto pass = 0; pass < 2; ++pass)
+    {
+        auto i = 0;
+        for (const auto &name : problem_factory.names())
+        {
+            const auto problem = problem_factory.create(name, 2, dimension);
+            EXPECT_EQ((*problem)(x), expected[i++]) << *problem << " pass " << pass;
+            // The second pass maps the files, and the rotations which are not modified stay views into them
+            EXPECT_EQ(problem->params().state.first_rotation.is_view(), pass == 1) << *problem;
+        }
+    }
+
+    const auto problem = problem_factory.create(1, 2, dimension);
+    auto rotation = problem->params().state.first_rotation;
+    ASSERT_TRUE(rotation.is_view());
+    const auto value = rotation[0][0];
+    rotation[0][0] += 1.0;
+    EXPECT_FALSE(rotation.is_view());
+    EXPECT_EQ(problem->params().state.first_rotation[0][0], value);
+    EXPECT_EQ(rotation[0][0], value + 1.0);
+    const auto files = std::distance(fs::directory_iterator(directory), fs::directory_iterator{});
+    EXPECT_EQ(files, static_cast<long>(problem_factory.names().size()));
+
+    InstanceCache::disable();
+    EXPECT_TRUE(InstanceCache::directory().empty());
+    remove_all(directory);
+}
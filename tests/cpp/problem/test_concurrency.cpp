@@ -0,0 +1,179 @@
+#include <thread>
+#include <gtest/gtest.h>
+#include "ioh.hpp"
+
+namespace
+{
+    struct Recorder final : ioh::logger::Base
+    {
+        std::vector<size_t> evaluations;
+        std::vector<double> values;
+
+        void track_problem(const ioh::problem::MetaData &) override {}
+        void track_suite(const std::string &) override {}
+        void flush() override {}
+
+        void log(const ioh::logger::LogInfo &log_info) override
+        {
+            evaluations.push_back(log_info.evaluations);
+            values.push_back(log_info.transformed_y);
+        }
+    };
+
+    //! Calls evaluate(i) for i in [0, n_samples), distributed round robin over n_threads threads
+    template <typename Evaluate>
+    void run_concurrently(const size_t n_samples, const size_t n_threads, const Evaluate &evaluate)
+    {
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < n_threads; ++t)
+            threads.emplace_back([&, t]() {
+                for (auto i = t; i < n_samples; i += n_threads)
+                    evaluate(i);
+            });
+        for (auto &thread : threads)
+            thread.join();
+    }
+
+    template <typename T>
+    void evaluate_concurrently(ioh::problem::Problem<T> &problem, const std::vector<std::vector<T>> &samples,
+                               const size_t n_threads)
+    {
+        run_concurrently(samples.size(), n_threads, [&](const size_t i) { problem(samples[i]); });
+    }
+
+    //! Checks that concurrent evaluations of each problem of a factory end in the state of sequential ones
+    template <typename Factory>
+    void check_concurrent_evaluation(const Factory &problem_factory, const int dimension)
+    {
+        const auto n_samples = 200;
+
+        std::vector<std::vector<double>> samples;
+        for (auto i = 0; i < n_samples; ++i)
+            samples.push_back(ioh::common::random::uniform(dimension, 7 + i, -5, 5));
+
+        for (const auto &name : problem_factory.names())
+        {
+            const auto sequential = problem_factory.create(name, 2, dimension);
+            for (const auto &x : samples)
+                (*sequential)(x);
+
+            const auto concurrent = problem_factory.create(name, 2, dimension);
+            concurrent->set_concurrent(true);
+            evaluate_concurrently(*concurrent, samples, 4);
+
+            const auto expected = sequential->state();
+            const auto state = concurrent->state();
+            EXPECT_EQ(state.evaluations, n_samples) << *concurrent;
+            EXPECT_DOUBLE_EQ(state.current_best.y, expected.current_best.y) << *concurrent;
+            EXPECT_EQ(state.current_best.x, expected.current_best.x) << *concurrent;
+            EXPECT_EQ(state.current_best_internal.x, expected.current_best_internal.x) << *concurrent;
+            // Evaluation numbers follow the order in which the threads finish, so only their range is fixed
+            EXPECT_GE(state.best_evaluation, 1) << *concurrent;
+            EXPECT_LE(state.best_evaluation, n_samples) << *concurrent;
+
+            // Evaluations continue from the merged state once the problem is sequential again
+            concurrent->set_concurrent(false);
+            (*concurrent)(samples.front());
+            EXPECT_EQ(concurrent->state().evaluations, n_samples + 1) << *concurrent;
+
+            concurrent->reset();
+            EXPECT_EQ(concurrent->state().evaluations, 0) << *concurrent;
+        }
+    }
+}
+
+TEST(problems, concurrent_evaluation)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    check_concurrent_evaluation(ioh::problem::ProblemRegistry<ioh::problem::Real>::instance(), 8);
+}
+
+TEST(problems, concurrent_evaluation_large_scale)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    check_concurrent_evaluation(ioh::problem::ProblemRegistry<ioh::problem::LargeScaleBBOB>::instance(), 100);
+}
+
+TEST(problems, concurrent_evaluation_integer)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::Integer>::instance();
+    const size_t n_samples = 200, dimension = 16;
+
+    std::vector<int> parent_x;
+    for (const auto r : ioh::common::random::uniform(dimension, 5))
+        parent_x.push_back(r < 0.5 ? 0 : 1);
+
+    std::vector<std::vector<size_t>> flips;
+    std::vector<std::vector<int>> samples;
+    for (size_t i = 0; i < n_samples; ++i)
+    {
+        std::vector<size_t> flipped{i % dimension};
+        if ((i * 7 + 3) % dimension != flipped.front())
+            flipped.push_back((i * 7 + 3) % dimension);
+
+        auto x = parent_x;
+        for (const auto j : flipped)
+            x[j] = 1 - x[j];
+        flips.push_back(flipped);
+        samples.push_back(x);
+    }
+
+    // Instance 1 is untransformed, 2 flips the bits and 51 reorders them
+    for (const auto instance : {1, 2, 51})
+        for (const auto &name : problem_factory.names())
+        {
+            const auto sequential = problem_factory.create(name, instance, dimension);
+            for (const auto &x : samples)
+                (*sequential)(x);
+
+            // Each thread alternates between both problems, the packed solutions and the flips of a parent
+            const auto packed = problem_factory.create(name, instance, dimension);
+            const auto flipped = problem_factory.create(name, instance, dimension);
+            packed->set_concurrent(true);
+            flipped->set_concurrent(true);
+            const auto parent = flipped->make_parent(parent_x);
+            run_concurrently(n_samples, 4, [&](const size_t i) {
+                (*packed)(ioh::common::BitString(samples[i]));
+                flipped->evaluate_flips(parent, flips[i]);
+            });
+
+            // Several samples can share the best value, and the evaluation numbers follow the order in which the
+            // threads finish, so the best solution is only checked to be consistent with its value
+            const auto expected = sequential->state();
+            const auto reference = problem_factory.create(name, instance, dimension);
+            for (const auto &problem : {packed.get(), flipped.get()})
+            {
+                const auto state = problem->state();
+                EXPECT_EQ(state.evaluations, static_cast<int>(n_samples)) << *problem;
+                EXPECT_DOUBLE_EQ(state.current_best.y, expected.current_best.y) << *problem;
+                EXPECT_DOUBLE_EQ((*reference)(state.current_best.x), state.current_best.y) << *problem;
+                EXPECT_EQ(state.current_best_internal.x, reference->state().current_internal.x) << *problem;
+                EXPECT_DOUBLE_EQ(state.current_best_internal.y, expected.current_best_internal.y) << *problem;
+            }
+        }
+}
+
+TEST(problems, concurrent_evaluation_logged_in_order)
+{
+    const auto n_samples = 100, dimension = 5;
+    std::vector<std::vector<double>> samples;
+    for (auto i = 0; i < n_samples; ++i)
+        samples.push_back(ioh::common::random::uniform(dimension, 3 + i, -5, 5));
+
+    Recorder recorder;
+    ioh::problem::bbob::Sphere problem(1, dimension);
+    problem.set_concurrent(true);
+    problem.attach_logger(recorder);
+    evaluate_concurrently(problem, samples, 3);
+
+    ASSERT_EQ(recorder.evaluations.size(), static_cast<size_t>(n_samples));
+    for (size_t i = 0; i < recorder.evaluations.size(); ++i)
+        EXPECT_EQ(recorder.evaluations[i], i + 1);
+
+    auto best = recorder.values.front();
+    for (const auto y : recorder.values)
+        best = std::min(best, y);
+    EXPECT_DOUBLE_EQ(problem.state().current_best.y, best);
+    EXPECT_EQ(problem.state().evaluations, n_samples);
+}
@@ -0,0 +1,59 @@
+#include <numeric>
+#include <vector>
+#include "ioh.hpp"
+#include <gtest/gtest.h>
+
+TEST(LargeScaleBBOB, block_rotation)
+{
+    using ioh::problem::large_scale::BlockRotation;
+    for (const auto &[n, b] : std::vector<std::pair<size_t, size_t>>{{5, 5}, {100, 40}, {1001, 40}})
+    {
+        const BlockRotation rotation(n, b, 42);
+        const auto x = ioh::common::random::uniform(n, 7, -5, 5);
+        std::vector<double> y(n), z(n), buffer(n);
+
+        rotation.apply(x.data(), y.data(), buffer.data());
+        EXPECT_NEAR(std::inner_product(y.begin(), y.end(), y.begin(), 0.0),
+                    std::inner_product(x.begin(), x.end(), x.begin(), 0.0), 1e-9);
+
+        rotation.apply_transpose(y.data(), z.data(), buffer.data());
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_NEAR(z[i], x[i], 1e-12);
+
+        const auto permutation = BlockRotation::permutation(n, b, 3);
+        auto sorted = permutation;
+        std::sort(sorted.begin(), sorted.end());
+        for (size_t i = 0; i < n; ++i)
+            EXPECT_EQ(sorted[i], i);
+    }
+}
+
+TEST(LargeScaleBBOB, xopt_equals_yopt)
+{
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::LargeScaleBBOB>::instance();
+    EXPECT_EQ(problem_factory.names().size(), 24);
+    for (const auto dimension : {2, 40, 100, 1000})
+        for (const auto &name : problem_factory.names())
+        {
+            auto problem = problem_factory.create(name, 1, dimension);
+            EXPECT_NEAR(problem->objective().y, (*problem)(problem->objective().x), 1e-8) << *problem;
+        }
+}
+
+TEST(LargeScaleBBOB, suite)
+{
+    std::vector<int> problem_ids(24);
+    std::iota(std::begin(problem_ids), std::end(problem_ids), 1);
+
+    const auto suite = ioh::suite::SuiteRegistry<ioh::problem::Real>::instance().create(
+        "LargeScaleBBOB", problem_ids, {1, 2}, {2000});
+    EXPECT_EQ(suite->name(), "LargeScaleBBOB");
+    EXPECT_EQ(suite->size(), 48);
+
+    const auto x = ioh::common::random::uniform(2000, 3, -5, 5);
+    for (const auto &problem : *suite)
+    {
+        EXPECT_EQ(problem->meta_data().n_variables, 2000);
+        EXPECT_TRUE(std::isfinite((*problem)(x))) << *problem;
+    }
+}
@@ -55,3 +55,198 @@ TEST(PBOfitness, dimension100)
  " ( not " << y << ").";
     }
 }
+
+TEST(PBOfitness, neutrality_epistasis)
+{
+    namespace utils = ioh::problem::utils;
+    const std::vector<int> x{1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 1};
+    std::vector<int> out{7, 7};
+
+    utils::neutrality(x, 3, out);
+    EXPECT_EQ(out, (std::vector<int>{1, 0, 1}));
+    EXPECT_EQ(utils::neutrality(x, 3), out);
+
+    utils::epistasis(x, 4, out);
+    EXPECT_EQ(out.size(), x.size());
+    EXPECT_EQ(utils::epistasis(x, 4), out);
+}
+
+TEST(PBOfitness, bit_string)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::PBO>::instance();
+
+    for (const auto n : {16, 100})
+    {
+        std::vector<int> x(n);
+        for (auto i = 0; i < n; ++i)
+            x[i] = (i * 7 + 3) % 5 < 3;
+        const ioh::common::BitString packed(x);
+
+        for (const auto &name : problem_factory.names())
+            for (const auto instance : {1, 2, 51})
+            {
+                const auto problem = problem_factory.create(name, instance, n);
+                const auto reference = problem_factory.create(name, instance, n);
+                EXPECT_DOUBLE_EQ((*problem)(packed), (*reference)(x)) << name << " instance " << instance;
+                EXPECT_EQ(problem->state().evaluations, 1);
+                EXPECT_EQ(problem->state().current.x, x);
+                EXPECT_DOUBLE_EQ(problem->state().current.y, reference->state().current.y);
+                EXPECT_DOUBLE_EQ(problem->state().current_best.y, reference->state().current_best.y);
+
+                for (const auto tracking : {ioh::problem::Tracking::Full, ioh::problem::Tracking::Lightweight})
+                {
+                    problem->set_tracking(tracking);
+                    reference->set_tracking(tracking);
+                    for (auto i = 0; i < n; i += 7)
+                    {
+                        auto y = x;
+                        y[i] = 1 - y[i];
+                        if (i % 2 == 0)
+                            (*problem)(ioh::common::BitString(y));
+                        else
+                            (*problem)(y);
+                        (*reference)(y);
+                    }
+                    const auto state = problem->state();
+                    const auto expected = reference->state();
+                    EXPECT_EQ(state.current.x, expected.current.x) << name;
+                    EXPECT_EQ(state.current_internal.x, expected.current_internal.x) << name;
+                    EXPECT_EQ(state.current_best.x, expected.current_best.x) << name;
+                    EXPECT_EQ(state.current_best_internal.x, expected.current_best_internal.x) << name;
+                }
+            }
+    }
+}
+
+TEST(PBOfitness, bit_string_interleaved)
+{
+    ioh::problem::pbo::OneMax problem(1, 8);
+    const std::vector<int> a{1, 1, 0, 0, 0, 0, 0, 0};
+    const std::vector<int> b{1, 1, 1, 1, 1, 1, 0, 0};
+    const std::vector<int> c{1, 1, 1, 1, 1, 1, 1, 0};
+    const std::vector<int> d{0, 0, 0, 0, 0, 0, 0, 1};
+
+    for (const auto tracking : {ioh::problem::Tracking::Full, ioh::problem::Tracking::Lightweight})
+    {
+        problem.set_tracking(tracking);
+        problem.reset();
+        problem(a);
+        problem(ioh::common::BitString(d));
+        problem(b);
+        auto state = problem.state();
+        EXPECT_EQ(state.current_best.y, 6);
+        EXPECT_EQ(state.current_best.x, b);
+        EXPECT_EQ(state.current.x, b);
+
+        problem(ioh::common::BitString(d));
+        auto parent = problem.make_parent(c);
+        problem.evaluate_flips(parent, {0});
+        state = problem.state();
+        auto expected = c;
+        expected[0] = 0;
+        EXPECT_EQ(state.current.x, expected);
+        EXPECT_EQ(state.current_best.x, b);
+    }
+}
+
+TEST(PBOfitness, evaluate_flips)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::PBO>::instance();
+
+    for (const auto n : {16, 100})
+    {
+        const auto random_numbers = ioh::common::random::uniform(static_cast<size_t>(n) * 6, n);
+        std::vector<int> x(n);
+        for (auto i = 0; i < n; ++i)
+            x[i] = random_numbers[i] < 0.5;
+
+        for (const auto &name : problem_factory.names())
+            for (const auto instance : {1, 2, 51})
+            {
+                const auto problem = problem_factory.create(name, instance, n);
+                const auto reference = problem_factory.create(name, instance, n);
+                auto parent = problem->make_parent(x);
+                EXPECT_EQ(problem->state().evaluations, 0);
+                EXPECT_DOUBLE_EQ(parent.solution.y, (*reference)(x)) << name << " instance " << instance;
+
+                auto y = x;
+                for (auto k = 1; k <= 5; ++k)
+                {
+                    std::vector<size_t> flipped;
+                    for (auto j = 0; j < k; ++j)
+                    {
+                        const auto i = static_cast<size_t>(random_numbers[n * k + j] * n);
+                        if (std::find(flipped.begin(), flipped.end(), i) == flipped.end())
+                            flipped.push_back(i);
+                    }
+                    for (const auto i : flipped)
+                        y[i] = 1 - y[i];
+
+                    EXPECT_DOUBLE_EQ(problem->evaluate_flips(parent, flipped), (*reference)(y))
+                        << name << " instance " << instance << " flips " << k;
+                    EXPECT_EQ(problem->state().current.x, y);
+                    EXPECT_EQ(problem->state().current_internal.x, reference->state().current_internal.x);
+                    EXPECT_DOUBLE_EQ(problem->state().current.y, reference->state().current.y);
+
+                    problem->apply_flips(parent, flipped);
+                    EXPECT_EQ(parent.solution.x, y);
+                }
+                EXPECT_EQ(problem->state().evaluations, 5);
+                const auto fresh = problem->make_parent(y);
+                EXPECT_DOUBLE_EQ(parent.solution.y, fresh.solution.y) << name << " instance " << instance;
+                EXPECT_EQ(parent.data, fresh.data);
+            }
+    }
+}
+
+TEST(PBOfitness, labs_neighbors)
+{
+    const auto n = 101;
+    const auto random_numbers = ioh::common::random::uniform(n, 7);
+    std::vector<int> x(n);
+    for (auto i = 0; i < n; ++i)
+        x[i] = random_numbers[i] < 0.5;
+
+    for (const auto instance : {1, 2, 51})
+    {
+        ioh::problem::pbo::LABS problem(instance, n);
+        ioh::problem::pbo::LABS reference(instance, n);
+        const auto parent = problem.make_parent(x);
+
+        std::vector<double> y(n);
+        problem.evaluate_neighbors(parent, y.data());
+        EXPECT_EQ(problem.state().evaluations, n);
+        for (auto i = 0; i < n; ++i)
+        {
+            auto neighbor = x;
+            neighbor[i] = 1 - neighbor[i];
+            EXPECT_DOUBLE_EQ(y[i], reference(neighbor)) << "instance " << instance << " bit " << i;
+        }
+        EXPECT_DOUBLE_EQ(problem.state().current_best.y, reference.state().current_best.y);
+    }
+}
+
+TEST(PBOfitness, labs_fft)
+{
+    for (const auto n : {ioh::problem::pbo::LABS::fft_crossover - 1, ioh::problem::pbo::LABS::fft_crossover, 1000})
+    {
+        const auto random_numbers = ioh::common::random::uniform(n, n);
+        std::vector<int> x(n);
+        for (auto i = 0; i < n; ++i)
+            x[i] = random_numbers[i] < 0.5;
+
+        auto energy = 0.0;
+        for (auto k = 1; k < n; ++k)
+        {
+            auto cor = 0;
+            for (auto i = 0; i < n - k; ++i)
+                cor += (x[i] * 2 - 1) * (x[i + k] * 2 - 1);
+            energy += static_cast<double>(cor) * cor;
+        }
+
+        ioh::problem::pbo::LABS problem(1, n);
+        EXPECT_EQ(problem(x), static_cast<double>(n * n) / 2.0 / energy) << "n " << n;
+    }
+}
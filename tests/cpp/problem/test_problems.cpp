@@ -1,3 +1,4 @@
+#include <array>
 #include <cmath>
 #include <list>
 #include <gtest/gtest.h>
@@ -181,8 +182,210 @@ TEST(problems, bbob5d)
     }
 }
 
+TEST(problems, evaluate_batch)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::Real>::instance();
+    const auto n_samples = 10, dimension = 5;
+    auto x = ioh::common::random::uniform(n_samples * dimension, 42, -5, 5);
+    x[3 * dimension + 1] = std::numeric_limits<double>::quiet_NaN();
 
+    for (const auto &name : problem_factory.names())
+    {
+        auto batch = problem_factory.create(name, 1, dimension);
+        auto sequential = problem_factory.create(name, 1, dimension);
 
+        std::vector<double> y(n_samples);
+        batch->evaluate_batch(x.data(), n_samples, y.data());
 
+        for (auto i = 0; i < n_samples; ++i)
+        {
+            const auto expected = (*sequential)(std::vector<double>(x.begin() + i * dimension,
+                                                                    x.begin() + (i + 1) * dimension));
+            if (i == 3)
+                EXPECT_TRUE(ioh::common::is_nan(y.at(i))) << *batch;
+            else
+                EXPECT_DOUBLE_EQ(expected, y.at(i)) << *batch;
+        }
+        EXPECT_EQ(batch->state().evaluations, n_samples - 1) << *batch;
+        EXPECT_EQ(batch->state().evaluations, sequential->state().evaluations) << *batch;
+        EXPECT_DOUBLE_EQ(batch->state().current_best.y, sequential->state().current_best.y) << *batch;
+    }
 
+    const auto problem = std::make_shared<ioh::problem::pbo::OneMax>(1, 4);
+    const auto y = problem->evaluate_batch({1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0});
+    EXPECT_EQ(y, std::vector<double>({2., 4., 0.}));
+    EXPECT_EQ(problem->state().evaluations, 3);
+    EXPECT_TRUE(problem->evaluate_batch({1, 1, 0}).empty());
+}
+
+TEST(problems, evaluate_contiguous)
+{
+    const auto vector_problem = std::make_shared<ioh::problem::bbob::Sphere>(1, 4);
+    const auto problem = std::make_shared<ioh::problem::bbob::Sphere>(1, 4);
+    const std::array<double, 4> x = {1., -2., 3., -4.};
+
+    const auto expected = (*vector_problem)(std::vector<double>(x.begin(), x.end()));
+    EXPECT_DOUBLE_EQ((*problem)(x.data(), x.size()), expected);
+    EXPECT_DOUBLE_EQ((*problem)(x), expected);
+    EXPECT_EQ(problem->state().evaluations, 2);
+    EXPECT_DOUBLE_EQ(problem->state().current_best.y, vector_problem->state().current_best.y);
+    EXPECT_EQ(problem->state().current.x, vector_problem->state().current.x);
+
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    EXPECT_TRUE(ioh::common::is_nan((*problem)(x.data(), 3)));
+    EXPECT_EQ(problem->state().evaluations, 2);
+}
 
+TEST(problems, validation)
+{
+    using ioh::problem::Validation;
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const std::vector<double> x_nan = {0., std::numeric_limits<double>::quiet_NaN(), 0., 0.};
+
+    const std::vector<double> x_out = {0., 6., 0., 0.};
+
+    ioh::problem::bbob::Sphere problem(1, 4);
+    EXPECT_EQ(problem.validation(), Validation::Finite);
+    EXPECT_TRUE(ioh::common::is_nan(problem(x_nan)));
+    EXPECT_TRUE(ioh::common::is_nan(problem(std::vector<double>(3))));
+    EXPECT_EQ(problem.state().evaluations, 0);
+    problem(x_out);
+    EXPECT_EQ(problem.state().evaluations, 1);
+
+    problem.set_validation(Validation::Full);
+    EXPECT_TRUE(ioh::common::is_nan(problem(x_out)));
+    EXPECT_TRUE(ioh::common::is_nan(problem(x_nan)));
+    std::vector<double> y(2);
+    auto batch = x_out;
+    batch.insert(batch.end(), 4, 0.);
+    problem.evaluate_batch(batch.data(), 2, y.data());
+    EXPECT_TRUE(ioh::common::is_nan(y[0]));
+    EXPECT_FALSE(ioh::common::is_nan(y[1]));
+    EXPECT_EQ(problem.state().evaluations, 2);
+
+    problem.set_validation(Validation::Dimension);
+    EXPECT_TRUE(ioh::common::is_nan(problem(std::vector<double>(3))));
+    EXPECT_EQ(problem.state().evaluations, 2);
+    problem(x_nan);
+    EXPECT_EQ(problem.state().evaluations, 3);
+
+    problem.set_validation(Validation::None);
+    EXPECT_DOUBLE_EQ(problem(problem.objective().x), problem.objective().y);
+    EXPECT_EQ(problem.state().evaluations, 4);
+    EXPECT_TRUE(problem.state().optimum_found);
+
+    problem.set_validation(Validation::Finite);
+    EXPECT_TRUE(ioh::common::is_nan(problem.evaluate_with<Validation::Full>(x_out)));
+    EXPECT_TRUE(ioh::common::is_nan(problem.evaluate_with<Validation::Dimension>(std::vector<double>(3))));
+    EXPECT_EQ(problem.state().evaluations, 4);
+    EXPECT_DOUBLE_EQ(problem.evaluate_with<Validation::None>(problem.objective().x), problem.objective().y);
+    EXPECT_EQ(problem.state().evaluations, 5);
+
+    const ioh::problem::Constraint<double> constraint(3, 5., -5.);
+    EXPECT_TRUE(constraint.check({-5., 0., 5.}));
+    EXPECT_FALSE(constraint.check({-5., 0., 5.1}));
+    EXPECT_FALSE(constraint.check({0., 0.}));
+    const std::vector<double> x_in = {-5., 0., 5.};
+    EXPECT_TRUE(constraint.check(x_in.data(), x_in.size()));
+    EXPECT_FALSE(constraint.check(x_in.data(), 2));
+}
+
+TEST(problems, lightweight_tracking)
+{
+    const auto dimension = 64;
+    ioh::problem::pbo::OneMax full(1, dimension);
+    ioh::problem::pbo::OneMax lightweight(1, dimension);
+    lightweight.set_tracking(ioh::problem::Tracking::Lightweight);
+
+    for (auto i = 0; i < 50; ++i)
+    {
+        std::vector<int> x;
+        for (const auto r : ioh::common::random::uniform(dimension, i))
+            x.push_back(r < 0.5 ? 0 : 1);
+
+        EXPECT_DOUBLE_EQ(full(x), lightweight(x));
+        const auto expected = full.state();
+        const auto state = lightweight.state();
+        EXPECT_EQ(state.evaluations, expected.evaluations);
+        EXPECT_EQ(state.best_evaluation, expected.best_evaluation);
+        EXPECT_DOUBLE_EQ(state.current_best.y, expected.current_best.y);
+        EXPECT_EQ(state.current_best.x, expected.current_best.x);
+        EXPECT_EQ(state.current_best_internal.x, expected.current_best_internal.x);
+        EXPECT_EQ(state.current.x, x);
+    }
+}
+
+
+TEST(problems, clone)
+{
+    ioh::common::log::log_level = ioh::common::log::Level::Warning;
+    const auto &problem_factory = ioh::problem::ProblemRegistry<ioh::problem::Real>::instance();
+    const auto dimension = 10;
+    const auto x = ioh::common::random::uniform(dimension, 3, -5, 5);
+
+    for (const auto &name : problem_factory.names())
+    {
+        const auto problem = problem_factory.create(name, 3, dimension);
+        (*problem)(x);
+
+        const auto clone = problem->clone();
+        ASSERT_NE(clone, nullptr) << *problem;
+        EXPECT_EQ(clone->meta_data().name, problem->meta_data().name);
+        EXPECT_EQ(clone->objective().x, problem->objective().x);
+        EXPECT_EQ(clone->state().evaluations, 0) << *clone;
+        EXPECT_DOUBLE_EQ((*clone)(x), problem->state().current.y) << *clone;
+        EXPECT_EQ(problem->state().evaluations, 1) << *problem;
+    }
+
+    ioh::problem::pbo::NKLandscapes nk(1, dimension);
+    const auto nk_clone = nk.clone();
+    const std::vector<int> bits(dimension, 1);
+    EXPECT_DOUBLE_EQ((*nk_clone)(bits), nk(bits));
+
+    const ioh::problem::WrappedProblem<double> wrapped(
+        [](const std::vector<double> &v) { return v.front(); }, "clone_wrapped", dimension);
+    EXPECT_DOUBLE_EQ((*wrapped.clone())(x), x.front());
+
+    ioh::problem::WrappedProblem<double> assigned(
+        [](const std::vector<double> &v) { return v.back(); }, "clone_assigned", dimension + 1);
+    assigned(ioh::common::random::uniform(dimension + 1, 4, -5, 5));
+    assigned = wrapped;
+    EXPECT_EQ(assigned.meta_data().name, "clone_wrapped");
+    EXPECT_EQ(assigned.meta_data().n_variables, dimension);
+    EXPECT_EQ(assigned.state().evaluations, 0);
+    EXPECT_DOUBLE_EQ(assigned(x), x.front());
+    EXPECT_EQ(assigned.state().evaluations, 1);
+}
+
+template <typename P>
+void check_copy_assignment(const int n_variables)
+{
+    static_assert(std::is_copy_assignable<P>::value);
+    using T = typename decltype(std::declval<P>().objective().x)::value_type;
+    std::vector<T> x;
+    for (const auto xi : ioh::common::random::uniform(n_variables, 6, -5, 5))
+        x.push_back(std::is_integral<T>::value ? static_cast<T>(xi > 0) : static_cast<T>(xi));
+    P problem(1, n_variables);
+    P other(2, n_variables);
+    const auto expected = other(x);
+    problem(x);
+
+    problem = other;
+    EXPECT_EQ(problem.meta_data().instance, 2) << problem;
+    EXPECT_EQ(problem.objective().x, other.objective().x) << problem;
+    EXPECT_EQ(problem.state().evaluations, 0) << problem;
+    EXPECT_EQ(problem(x), expected) << problem;
+    EXPECT_EQ(problem.state().evaluations, 1) << problem;
+}
+
+TEST(problems, copy_assignment)
+{
+    using namespace ioh::problem;
+    check_copy_assignment<bbob::Sphere>(5);
+    check_copy_assignment<bbob::AttractiveSector>(5);
+    check_copy_assignment<bbob::Gallagher101>(5);
+    check_copy_assignment<large_scale::LargeScaleEllipsoidRotated>(50);
+    check_copy_assignment<large_scale::LargeScaleGallagher21>(50);
+    check_copy_assignment<pbo::OneMax>(16);
+}